@@ -1,5 +1,14 @@
 CPP_SRCS += \
+	argument_capturing_tests.cpp \
+	argument_formatting_tests.cpp \
 	argument_matching_tests.cpp \
+	call_budget_tests.cpp \
+	call_recording_tests.cpp \
+	check_verification_tests.cpp \
+	chrome_trace_tests.cpp \
+	composite_argument_matching_tests.cpp \
+	constant_return_tests.cpp \
+	core_header_tests.cpp \
 	cpp14_tests.cpp \
 	custom_event_formatting_tests.cpp \
 	custom_testing_framework_tests.cpp \
@@ -7,21 +16,31 @@ CPP_SRCS += \
 	default_event_formatting_tests.cpp \
 	dtor_mocking_tests.cpp \
 	event_notification_tests.cpp \
+	extern_mock_instantiations.cpp \
+	extern_mock_tests.cpp \
 	functional.cpp \
 	gcc_stubbing_multiple_values_tests.cpp \
 	gcc_type_info_tests.cpp \
+	invocation_event_tests.cpp \
+	method_stats_tests.cpp \
 	miscellaneous_tests.cpp \
+	prototype_vtable_tests.cpp \
 	msc_stubbing_multiple_values_tests.cpp \
 	msc_type_info_tests.cpp \
+	overloadded_methods_tests.cpp \
 	referece_types_tests.cpp \
 	remove_const_volatile_tests.cpp \
 	rvalue_arguments_tests.cpp \
 	sequence_verification_tests.cpp \
+	set_argument_matching_tests.cpp \
 	spying_tests.cpp \
 	streaming_tests.cpp \
+	string_argument_matching_tests.cpp \
 	stubbing_tests.cpp \
 	tpunit++main.cpp \
 	type_info_tests.cpp \
 	verification_errors_tests.cpp \
 	verification_tests.cpp \
-	VirtualOffsetSelectorTest.cpp 
+	virtual_offset_tests.cpp \
+	VirtualOffsetSelectorTest.cpp \
+	zero_allocation_tests.cpp 
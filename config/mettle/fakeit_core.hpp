@@ -0,0 +1,4 @@
+#pragma once
+
+#include "fakeit_instance.hpp"
+#include "fakeit/fakeit_core.hpp"
@@ -0,0 +1,7 @@
+#ifndef fakeit_core_h__
+#define fakeit_core_h__
+
+#include "fakeit_instance.hpp"
+#include "fakeit/fakeit_core.hpp"
+
+#endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "fakeit/DefaultFakeit.hpp"
+#include "fakeit/FakeitExceptions.hpp"
 
 namespace fakeit {
 
@@ -71,8 +72,7 @@ namespace fakeit {
         }
 
         virtual void handle(const UnexpectedMethodCallEvent &evt) override {
-            std::string format = _formatter.format(evt);
-            UnexpectedMethodCallException ex(format);
+            UnexpectedMethodCallException ex(_formatter, evt);
             throw ex;
         }
 
@@ -51,9 +51,20 @@ def writeHeaderComment(out, config):
     write_line(out, " */" )
 
 
+# The core (mocking & stubbing) is guarded, so fakeit_core.hpp and fakeit.hpp can be included in the same TU.
+def generateFakeitCoreText(out, config):
+    write_line(out, "#ifndef fakeit_single_header_core_h__" )
+    write_line(out, "#define fakeit_single_header_core_h__" )
+    parseFile(out, config, 'fakeit_core.hpp' )
+    write_line(out, "#endif" )
+
 def generateFakeitIncludeFile(out, config):
+    generateFakeitCoreText(out, config)
     parseFile(out, config, 'fakeit.hpp' )
 
+def generateFakeitCoreIncludeFile(out, config):
+    generateFakeitCoreText(out, config)
+
 comment_re = re.compile(
     r'(^)?[^\S\n]*/(?:\*(.*?)\*/[^\S\n]*|/[^\n]*)($)?',
     re.DOTALL | re.MULTILINE
@@ -80,19 +91,20 @@ def remove_comments(text):
 def remove_pragma_once(text):
     return pragmaOnceMatcher.sub('\n', text)
 
-def createFakeitFileText(config):
+def createFakeitFileText(config, generator):
+    processedHeaders.clear()
     textStream  = io.StringIO()
-    generateFakeitIncludeFile(textStream, config)
+    generator(textStream, config)
     text = textStream.getvalue()
     text = remove_comments(text)
     text = remove_pragma_once(text)
     return text
 
-def createFakeitFile(config,text):
+def createFakeitFile(config,text,fileName):
     dest_dir = os.path.join( fakeitPath, 'single_header', config)
     if (not os.path.exists(dest_dir)):
     	os.makedirs(dest_dir)
-    outputPath = os.path.join( dest_dir, 'fakeit.hpp' )
+    outputPath = os.path.join( dest_dir, fileName )
     out = open( outputPath, 'w' )
     write_line(out, "#pragma once" )
     writeHeaderComment(out, config)
@@ -101,5 +113,7 @@ def createFakeitFile(config,text):
 
 
 config = sys.argv[1]
-text = createFakeitFileText(config)
-createFakeitFile(config,text)
+text = createFakeitFileText(config, generateFakeitIncludeFile)
+createFakeitFile(config,text,'fakeit.hpp')
+text = createFakeitFileText(config, generateFakeitCoreIncludeFile)
+createFakeitFile(config,text,'fakeit_core.hpp')
@@ -26,6 +26,14 @@ namespace fakeit {
         virtual R invoke(const ArgumentsTuple<arglist...> &) = 0;
 
         virtual bool isDone() = 0;
+
+        /**
+         * Address of the value returned by every invocation of this action, whatever the arguments are.
+         * nullptr if the action is not a constant.
+         */
+        virtual const void *getConstantValue() {
+            return nullptr;
+        }
     };
 
     template<typename R, typename ... arglist>
@@ -75,6 +83,30 @@ namespace fakeit {
         std::function<R(typename fakeit::test_arg<arglist>::type...)> f;
     };
 
+    template<typename R, class Enable = void>
+    struct DefaultValueAddress {
+        static const void *get() {
+            // DefaultValue<R>::value() throws for this type.
+            return nullptr;
+        }
+    };
+
+    template<typename R>
+    struct DefaultValueAddress<R, typename std::enable_if<is_constructible_type<R>::value>::type> {
+        static const void *get() {
+            return &DefaultValue<R>::value();
+        }
+    };
+
+    template<>
+    struct DefaultValueAddress<void> {
+        static const void *get() {
+            // nothing is returned, any non null address will do.
+            static const char nothing{};
+            return &nothing;
+        }
+    };
+
     template<typename R, typename ... arglist>
     struct ReturnDefaultValue : public Action<R, arglist...> {
         virtual ~ReturnDefaultValue() = default;
@@ -86,6 +118,32 @@ namespace fakeit {
         virtual bool isDone() override {
             return false;
         }
+
+        virtual const void *getConstantValue() override {
+            return DefaultValueAddress<R>::get();
+        }
+    };
+
+    template<typename R, typename ... arglist>
+    struct ReturnConstantValue : public Action<R, arglist...> {
+        virtual ~ReturnConstantValue() = default;
+
+        ReturnConstantValue(const R &value) : _value(value) { }
+
+        virtual R invoke(const ArgumentsTuple<arglist...> &) override {
+            return _value;
+        }
+
+        virtual bool isDone() override {
+            return false;
+        }
+
+        virtual const void *getConstantValue() override {
+            return &_value;
+        }
+
+    private:
+        R _value;
     };
 
     template<typename R, typename ... arglist>
@@ -16,7 +16,6 @@
 #include "fakeit/invocation_matchers.hpp"
 #include "fakeit/ActualInvocationHandler.hpp"
 
-#include "mockutils/Finally.hpp"
 #include "mockutils/MethodInvocationHandler.hpp"
 
 namespace fakeit {
@@ -42,16 +41,41 @@ namespace fakeit {
             std::shared_ptr<Destructible> destructablePtr = _recordedActions.front();
             Destructible &destructable = *destructablePtr;
             Action<R, arglist...> &action = dynamic_cast<Action<R, arglist...> &>(destructable);
-            std::function<void()> finallyClause = [&]() -> void {
-                if (action.isDone())
-                    _recordedActions.erase(_recordedActions.begin());
-            };
-            Finally onExit(finallyClause);
+            RemoveIfDone onExit(_recordedActions, action);
             return action.invoke(args);
         }
 
+        /**
+         * Address of the value returned by every invocation of this sequence,
+         * or nullptr if the sequence is anything but a single constant action.
+         */
+        const void *getConstantValue() {
+            if (_recordedActions.size() != 2) // the action and the trailing NoMoreRecordedAction
+                return nullptr;
+            Destructible &destructable = *_recordedActions.front();
+            Action<R, arglist...> &action = dynamic_cast<Action<R, arglist...> &>(destructable);
+            return action.getConstantValue();
+        }
+
     private:
 
+        // Pops the front action once it is done, even if it threw.
+        // Used instead of Finally to keep the std::function (and its allocation) off the invocation path.
+        struct RemoveIfDone {
+            RemoveIfDone(std::vector<std::shared_ptr<Destructible>> &recordedActions, Action<R, arglist...> &action) :
+                    _recordedActions(recordedActions), _action(action) {
+            }
+
+            ~RemoveIfDone() {
+                if (_action.isDone())
+                    _recordedActions.erase(_recordedActions.begin());
+            }
+
+        private:
+            std::vector<std::shared_ptr<Destructible>> &_recordedActions;
+            Action<R, arglist...> &_action;
+        };
+
         struct NoMoreRecordedAction : Action<R, arglist...> {
 
 //            virtual ~NoMoreRecordedAction() override = default;
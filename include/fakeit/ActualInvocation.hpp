@@ -24,6 +24,67 @@
 
 namespace fakeit {
 
+    // the text of an argument that a copied invocation could not copy.
+    struct FormattedArgument {
+        std::string text;
+    };
+
+    template<>
+    struct BufferFormatter<FormattedArgument> {
+        static void format(std::string &out, FormattedArgument const &val) {
+            out += val.text;
+        }
+    };
+
+    namespace internal {
+
+        template<typename T, class Enable = void>
+        struct is_deep_copy_constructible : std::is_copy_constructible<T> {
+        };
+
+        // std::is_copy_constructible is true for a container of move only values, but its copy does not compile.
+        template<typename T>
+        struct is_deep_copy_constructible<T, typename std::enable_if<
+                !std::is_same<typename T::value_type, T>::value>::type>
+                : std::integral_constant<bool, std::is_copy_constructible<T>::value &&
+                                               is_deep_copy_constructible<typename T::value_type>::value> {
+        };
+
+        // char pointers are formatted as the text they point to, and a user formatter of a pointer may follow it.
+        template<typename T>
+        struct is_copied_as_value : std::integral_constant<bool, is_deep_copy_constructible<T>::value && !(
+                std::is_pointer<T>::value && (is_char_type<typename std::remove_cv<
+                        typename std::remove_pointer<T>::type>::type>::value || !has_default_formatter<T>::value))> {
+        };
+
+        /**
+         * How a copied invocation keeps an argument: a copy of its value when it can be copied safely,
+         * otherwise its text, formatted when the invocation is copied.
+         */
+        template<typename T, class Enable = void>
+        struct CopiedArgument {
+            typedef FormattedArgument type;
+
+            static type copy(const typename naked_type<T>::type &val) {
+                FormattedArgument formatted;
+                TypeBufferFormatter<T>::format(formatted.text, val);
+                return formatted;
+            }
+        };
+
+        template<typename T>
+        struct CopiedArgument<T, typename std::enable_if<is_copied_as_value<typename naked_type<T>::type>::value>::type> {
+            typedef typename naked_type<T>::type type;
+
+            static const type &copy(const type &val) {
+                return val;
+            }
+        };
+    }
+
+    template<typename ... arglist>
+    struct CopiedInvocation;
+
     template<typename ... arglist>
     struct ActualInvocation : public Invocation {
 
@@ -31,6 +92,13 @@ namespace fakeit {
             virtual bool matches(ActualInvocation<arglist...> &actualInvocation) = 0;
 
             virtual std::string format() const = 0;
+
+            /**
+             * Called on the dispatch path only, once the behavior selected by this matcher ran (or threw).
+             * Arguments that are not lvalue references may be moved from if canMove is true.
+             */
+            virtual void dispatched(ArgumentsTuple<arglist...> &, bool /*canMove*/) {
+            }
         };
 
         ActualInvocation(unsigned int ordinal, MethodInfo &method, const typename fakeit::production_arg<arglist>::type... args) :
@@ -55,10 +123,18 @@ namespace fakeit {
         }
 
         virtual std::string format() const override {
-            std::ostringstream out;
-            out << getMethod().name();
-            print(out, actualArguments);
-            return out.str();
+            std::string out;
+            formatTo(out);
+            return out;
+        }
+
+        virtual void formatTo(std::string &out) const override {
+            out += getMethod().name();
+            formatTuple(out, actualArguments);
+        }
+
+        virtual std::shared_ptr<Invocation> copy() const override {
+            return std::make_shared<CopiedInvocation<arglist...>>(getOrdinal(), getMethod(), actualArguments);
         }
 
     private:
@@ -67,6 +143,60 @@ namespace fakeit {
         ArgumentsTuple<arglist...> actualArguments;
     };
 
+    namespace internal {
+        struct CopiedMethod {
+            CopiedMethod(const MethodInfo &method) :
+                    _copiedMethod(method) {
+            }
+
+            MethodInfo _copiedMethod;
+        };
+    }
+
+    // an invocation with a copy of the method info and of the arguments, see Invocation::copy().
+    template<typename ... arglist>
+    struct CopiedInvocation : private internal::CopiedMethod, public Invocation {
+
+        typedef std::tuple<typename internal::CopiedArgument<arglist>::type...> CopiedArguments;
+
+        CopiedInvocation(unsigned int ordinal, const MethodInfo &method, const ArgumentsTuple<arglist...> &arguments) :
+                CopiedMethod(method),
+                Invocation(ordinal, _copiedMethod),
+                _arguments(copyArguments(arguments, make_index_sequence<sizeof...(arglist)>())) {
+        }
+
+        CopiedInvocation(const CopiedInvocation &other) :
+                CopiedMethod(other),
+                Invocation(other.getOrdinal(), _copiedMethod),
+                _arguments(other._arguments) {
+        }
+
+        virtual std::string format() const override {
+            std::string out;
+            formatTo(out);
+            return out;
+        }
+
+        virtual void formatTo(std::string &out) const override {
+            out += getMethod().name();
+            formatTuple(out, _arguments);
+        }
+
+        virtual std::shared_ptr<Invocation> copy() const override {
+            return std::make_shared<CopiedInvocation<arglist...>>(*this);
+        }
+
+    private:
+
+        template<std::size_t ... I>
+        static CopiedArguments copyArguments(const ArgumentsTuple<arglist...> &arguments, index_sequence<I...>) {
+            (void) arguments;
+            return CopiedArguments{internal::CopiedArgument<arglist>::copy(std::get<I>(arguments))...};
+        }
+
+        CopiedArguments _arguments;
+    };
+
     template<typename ... arglist>
     std::ostream &operator<<(std::ostream &strm, const ActualInvocation<arglist...> &ai) {
         strm << ai.format();
@@ -10,6 +10,8 @@ namespace fakeit {
 	struct ActualInvocationsContainer {
 		virtual void clear() = 0;
 
+		virtual void setInvocationHistoryEnabled(bool enabled) = 0;
+
 		virtual ~ActualInvocationsContainer() NO_THROWS { }
 	};
 
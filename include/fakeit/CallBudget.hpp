@@ -0,0 +1,112 @@
+/*
+ * CallBudget.hpp
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "fakeit/FakeitContext.hpp"
+#include "fakeit/FakeitEvents.hpp"
+#include "fakeit/EventHandler.hpp"
+#include "fakeit/MethodMockingContext.hpp"
+#include "mockutils/to_string.hpp"
+
+namespace fakeit {
+
+    /**
+     * Limits how many times a method may be called while the budget is in scope:
+     *
+     *   CallBudget budget(Method(mock, foo), 2);
+     *
+     * The call that goes over the limit is reported right away, as a failed AtMost verification
+     * pointing at that call, instead of when the test verifies. Calls made before the budget
+     * was created are not counted. Like any invocation event handler, a live budget sees
+     * the calls of constant stubs of mocks whose invocation history is disabled.
+     */
+    class CallBudget : public InvocationEventHandler {
+
+        FakeitContext &_fakeit;
+        std::shared_ptr<Sequence> _method; // deletes the concrete context, ~Sequence is protected.
+        std::vector<Sequence *> _expectedPattern;
+        Invocation::Matcher *_matcher;
+        int _budget;
+        int _calls;
+
+        const char *_file;
+        int _line;
+        const char *_testMethod;
+
+        CallBudget(const CallBudget &) = delete;
+
+        CallBudget &operator=(const CallBudget &) = delete;
+
+        template<typename R, typename ... arglist>
+        CallBudget(FakeitContext &fakeit, MockingContext<R, arglist...> *method, const int budget) :
+                _fakeit(fakeit), _method(method), _expectedPattern{method}, _budget(budget), _calls(0),
+                _file(""), _line(0), _testMethod("") {
+            if (budget < 0) {
+                throw std::invalid_argument(std::string("bad argument times:").append(fakeit::to_string(budget)));
+            }
+            std::vector<Invocation::Matcher *> expectedSequence;
+            _method->getExpectedSequence(expectedSequence);
+            _matcher = expectedSequence[0];
+            _fakeit.addInvocationEventHandler(*this);
+        }
+
+    public:
+
+        template<typename R, typename ... arglist>
+        CallBudget(MockingContext<R, arglist...> method, const int budget) :
+                CallBudget(Fakeit, new MockingContext<R, arglist...>(std::move(method)), budget) {
+        }
+
+        template<typename R, typename ... arglist>
+        CallBudget(FakeitContext &fakeit, MockingContext<R, arglist...> method, const int budget) :
+                CallBudget(fakeit, new MockingContext<R, arglist...>(std::move(method)), budget) {
+        }
+
+        ~CallBudget() {
+            _fakeit.removeInvocationEventHandler(*this);
+        }
+
+        CallBudget &setFileInfo(const char *file, int line, const char *callingMethod) {
+            _file = file;
+            _line = line;
+            _testMethod = callingMethod;
+            return *this;
+        }
+
+        /**
+         * The matching calls counted so far, including the one that went over the budget.
+         */
+        int calls() const {
+            return _calls;
+        }
+
+        int remaining() const {
+            return _calls < _budget ? _budget - _calls : 0;
+        }
+
+        virtual void handle(const InvocationEvent &e) override {
+            Invocation &invocation = const_cast<Invocation &>(e.getInvocation());
+            if (!_matcher->matches(invocation))
+                return;
+            if (++_calls <= _budget)
+                return;
+            std::vector<Invocation *> culprit{&invocation};
+            SequenceVerificationEvent evt(VerificationType::AtMost, _expectedPattern, culprit, 0, _calls, 0, 1,
+                                          _budget);
+            evt.setFileInfo(_file, _line, _testMethod);
+            _fakeit.handle(evt);
+        }
+    };
+
+}
@@ -0,0 +1,413 @@
+/*
+ * CallRecording.hpp
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+#pragma once
+
+// Not included by fakeit.hpp. Include it after fakeit.hpp or fakeit_core.hpp.
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "mockutils/Codec.hpp"
+#include "mockutils/MethodInvocationHandler.hpp"
+#include "mockutils/TupleDispatcher.hpp"
+#include "mockutils/type_utils.hpp"
+#include "fakeit/Action.hpp"
+#include "fakeit/SpyingContext.hpp"
+#include "fakeit/StubbingContext.hpp"
+
+namespace fakeit {
+
+    /**
+     * A call recording file is a header followed by records:
+     *   'M' u16 channel, u32 size, key           - names the channel of a recorded method.
+     *   'C' u16 channel, u32 size, arguments, u32 size, result - one call.
+     */
+    struct CallRecordingFormat {
+        static const char *magic() {
+            return "FKCR";
+        }
+
+        static const std::uint32_t VERSION = 1;
+        static const char METHOD = 'M';
+        static const char CALL = 'C';
+
+        static void appendSized(std::string &out, const std::string &bytes) {
+            Codec<std::uint32_t>::encode(out, (std::uint32_t) bytes.size());
+            out += bytes;
+        }
+    };
+
+    class CallRecorder;
+
+    class CallPlayer;
+
+    // calls the original method (as Spy does) and records the arguments with the result.
+    template<typename R, typename ... arglist>
+    struct RecordDelegateValue : public Action<R, arglist...> {
+
+        RecordDelegateValue(CallRecorder &recorder, std::uint16_t channel,
+                            std::function<R(const typename fakeit::test_arg<arglist>::type...)> delegate) :
+                _recorder(recorder), _channel(channel), _delegate(delegate) {
+        }
+
+        virtual ~RecordDelegateValue() = default;
+
+        virtual R invoke(const ArgumentsTuple<arglist...> &args) override {
+            return invoke(args, std::is_void<R>());
+        }
+
+        virtual bool isDone() override {
+            return false;
+        }
+
+    private:
+
+        R invoke(const ArgumentsTuple<arglist...> &args, std::false_type /* void */) {
+            R result = TupleDispatcher::invoke<R, arglist...>(_delegate, args);
+            _result.clear();
+            Codec<typename naked_type<R>::type>::encode(_result, result);
+            record(args);
+            return std::forward<R>(result);
+        }
+
+        void invoke(const ArgumentsTuple<arglist...> &args, std::true_type /* void */) {
+            TupleDispatcher::invoke<R, arglist...>(_delegate, args);
+            _result.clear();
+            record(args);
+        }
+
+        void record(const ArgumentsTuple<arglist...> &args);
+
+        CallRecorder &_recorder;
+        std::uint16_t _channel;
+        std::function<R(const typename fakeit::test_arg<arglist>::type...)> _delegate;
+        std::string _arguments;
+        std::string _result;
+    };
+
+    // answers with the result recorded for the same arguments.
+    template<typename R, typename ... arglist>
+    struct ReturnRecordedValue : public Action<R, arglist...> {
+
+        static_assert(!std::is_reference<R>::value, "recorded results can't be returned by reference");
+
+        ReturnRecordedValue(CallPlayer &player, std::uint16_t channel) :
+                _player(player), _channel(channel) {
+        }
+
+        virtual ~ReturnRecordedValue() = default;
+
+        virtual R invoke(const ArgumentsTuple<arglist...> &args) override {
+            _arguments.clear();
+            encodeTuple(_arguments, args);
+            const char *result;
+            std::uint32_t size;
+            if (!find(result, size)) {
+                // no call with these arguments was recorded, the call is unmatched.
+                throw NoMoreRecordedActionException();
+            }
+            return decode(result, result + size, std::is_void<R>());
+        }
+
+        virtual bool isDone() override {
+            return false;
+        }
+
+    private:
+
+        bool find(const char *&result, std::uint32_t &size);
+
+        static R decode(const char *data, const char *end, std::false_type /* void */) {
+            return Codec<typename naked_type<R>::type>::decode(data, end);
+        }
+
+        static void decode(const char *, const char *, std::true_type /* void */) {
+        }
+
+        CallPlayer &_player;
+        std::uint16_t _channel;
+        std::string _arguments;
+    };
+
+    /**
+     * Records the calls of spied methods (arguments and results) to a compact binary file, for a CallPlayer
+     * to answer them later without the real object:
+     *
+     *   CallRecorder recorder("query.calls");
+     *   recorder.Record("query", Method(spy, query)); // like Spy(Method(spy, query)), and records every call
+     *
+     * Arguments and results are written through their Codec. Calls that throw are not recorded.
+     * The recorder must live as long as the recorded methods are called.
+     */
+    class CallRecorder {
+
+        std::FILE *_file;
+        std::string _buffer;
+        std::size_t _bufferSize;
+        std::uint16_t _channels;
+        unsigned long long _calls;
+
+        CallRecorder(const CallRecorder &) = delete;
+
+        CallRecorder &operator=(const CallRecorder &) = delete;
+
+        void writeBuffer() {
+            std::fwrite(_buffer.data(), 1, _buffer.size(), _file);
+            _buffer.clear();
+        }
+
+    public:
+
+        static const std::size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+        CallRecorder(const std::string &path, std::size_t bufferSize = DEFAULT_BUFFER_SIZE) :
+                _file(std::fopen(path.c_str(), "wb")), _bufferSize(bufferSize), _channels(0), _calls(0) {
+            if (!_file) {
+                throw std::runtime_error(std::string("can't open call recording: ").append(path));
+            }
+            // the records are buffered here already.
+            std::setvbuf(_file, nullptr, _IONBF, 0);
+            _buffer.reserve(bufferSize + 256);
+            _buffer.append(CallRecordingFormat::magic(), 4);
+            Codec<std::uint32_t>::encode(_buffer, std::uint32_t(CallRecordingFormat::VERSION));
+        }
+
+        ~CallRecorder() {
+            close();
+        }
+
+        /**
+         * Spies the method and records its calls under the given key.
+         */
+        template<typename R, typename ... arglist>
+        void Record(const std::string &key, const SpyingContext<R, arglist...> &root) {
+            if (!_file) {
+                throw std::logic_error("call recording is closed");
+            }
+            if (_channels == 0xFFFF) {
+                throw std::length_error("too many recorded methods");
+            }
+            std::uint16_t channel = _channels++;
+            _buffer += CallRecordingFormat::METHOD;
+            Codec<std::uint16_t>::encode(_buffer, channel);
+            CallRecordingFormat::appendSized(_buffer, key);
+
+            SpyingContext<R, arglist...> &rootWithoutConst = const_cast<SpyingContext<R, arglist...> &>(root);
+            auto methodFromOriginalVT = rootWithoutConst.getOriginalMethod();
+            rootWithoutConst.appendAction(new RecordDelegateValue<R, arglist...>(*this, channel, methodFromOriginalVT));
+            rootWithoutConst.commit();
+        }
+
+        void write(std::uint16_t channel, const std::string &arguments, const std::string &result) {
+            if (!_file)
+                return;
+            _buffer += CallRecordingFormat::CALL;
+            Codec<std::uint16_t>::encode(_buffer, channel);
+            CallRecordingFormat::appendSized(_buffer, arguments);
+            CallRecordingFormat::appendSized(_buffer, result);
+            _calls++;
+            if (_buffer.size() >= _bufferSize)
+                writeBuffer();
+        }
+
+        unsigned long long calls() const {
+            return _calls;
+        }
+
+        void flush() {
+            if (!_file)
+                return;
+            writeBuffer();
+        }
+
+        /**
+         * Calls made after the recording is closed are still answered by the original method, but not recorded.
+         */
+        void close() {
+            if (!_file)
+                return;
+            writeBuffer();
+            std::fclose(_file);
+            _file = nullptr;
+        }
+    };
+
+    /**
+     * Answers the calls of a method with the results recorded by a CallRecorder, looked up by the arguments:
+     *
+     *   CallPlayer player("query.calls");
+     *   player.Replay("query", Method(mock, query));
+     *
+     * The file is read once, then every call is answered from memory.
+     * Calls with the same arguments get the recorded results in the recorded order, and the last one after that.
+     * A call with arguments that were never recorded is unmatched (see UnexpectedMethodCallException).
+     */
+    class CallPlayer {
+
+        struct RecordedResults {
+            std::uint16_t channel;
+            const char *arguments;
+            std::uint32_t argumentsSize;
+            std::vector<std::pair<const char *, std::uint32_t>> results;
+            std::size_t next;
+        };
+
+        std::string _data;
+        std::unordered_map<std::string, std::uint16_t> _channels;
+        std::unordered_map<std::size_t, std::vector<RecordedResults>> _index;
+        unsigned long long _calls;
+
+        CallPlayer(const CallPlayer &) = delete;
+
+        CallPlayer &operator=(const CallPlayer &) = delete;
+
+        // FNV-1a
+        static std::size_t hash(std::uint16_t channel, const char *data, std::size_t size) {
+            std::uint64_t h = 14695981039346656037ULL ^ channel;
+            for (std::size_t i = 0; i < size; i++) {
+                h ^= (unsigned char) data[i];
+                h *= 1099511628211ULL;
+            }
+            return (std::size_t) h;
+        }
+
+        static void readFile(const std::string &path, std::string &into) {
+            std::FILE *file = std::fopen(path.c_str(), "rb");
+            if (!file) {
+                throw std::runtime_error(std::string("can't open call recording: ").append(path));
+            }
+            char chunk[64 * 1024];
+            std::size_t read;
+            while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+                into.append(chunk, read);
+            std::fclose(file);
+        }
+
+        static const char *readSized(const char *&data, const char *end, std::uint32_t &size) {
+            size = Codec<std::uint32_t>::decode(data, end);
+            internal::checkEncodedSize(data, end, size);
+            const char *bytes = data;
+            data += size;
+            return bytes;
+        }
+
+        RecordedResults &resultsOf(std::uint16_t channel, const char *arguments, std::uint32_t argumentsSize) {
+            std::vector<RecordedResults> &bucket = _index[hash(channel, arguments, argumentsSize)];
+            for (auto &results : bucket) {
+                if (results.channel == channel && results.argumentsSize == argumentsSize &&
+                    std::memcmp(results.arguments, arguments, argumentsSize) == 0)
+                    return results;
+            }
+            bucket.push_back(RecordedResults{channel, arguments, argumentsSize, {}, 0});
+            return bucket.back();
+        }
+
+        void load() {
+            const char *data = _data.data();
+            const char *end = data + _data.size();
+            internal::checkEncodedSize(data, end, 4);
+            if (std::memcmp(data, CallRecordingFormat::magic(), 4) != 0) {
+                throw std::runtime_error("not a call recording");
+            }
+            data += 4;
+            if (Codec<std::uint32_t>::decode(data, end) != CallRecordingFormat::VERSION) {
+                throw std::runtime_error("unsupported call recording version");
+            }
+            while (data < end) {
+                char type = *data++;
+                std::uint16_t channel = Codec<std::uint16_t>::decode(data, end);
+                std::uint32_t size;
+                const char *bytes = readSized(data, end, size);
+                if (type == CallRecordingFormat::METHOD) {
+                    _channels[std::string(bytes, size)] = channel;
+                } else if (type == CallRecordingFormat::CALL) {
+                    std::uint32_t resultSize;
+                    const char *result = readSized(data, end, resultSize);
+                    resultsOf(channel, bytes, size).results.push_back(std::make_pair(result, resultSize));
+                    _calls++;
+                } else {
+                    throw std::runtime_error("corrupt call recording");
+                }
+            }
+        }
+
+    public:
+
+        CallPlayer(const std::string &path) : _calls(0) {
+            readFile(path, _data);
+            load();
+        }
+
+        /**
+         * Answers the calls of the method with the calls recorded under the given key.
+         */
+        template<typename R, typename ... arglist>
+        void Replay(const std::string &key, const StubbingContext<R, arglist...> &root) {
+            auto channel = _channels.find(key);
+            if (channel == _channels.end()) {
+                throw std::invalid_argument(std::string("no calls recorded for: ").append(key));
+            }
+            StubbingContext<R, arglist...> &rootWithoutConst = const_cast<StubbingContext<R, arglist...> &>(root);
+            rootWithoutConst.appendAction(new ReturnRecordedValue<R, arglist...>(*this, channel->second));
+            rootWithoutConst.commit();
+        }
+
+        /**
+         * The result recorded for the arguments, in the recorded order. False if none was recorded.
+         */
+        bool find(std::uint16_t channel, const std::string &arguments, const char *&result, std::uint32_t &size) {
+            auto bucket = _index.find(hash(channel, arguments.data(), arguments.size()));
+            if (bucket == _index.end())
+                return false;
+            for (auto &recorded : bucket->second) {
+                if (recorded.channel != channel || recorded.argumentsSize != arguments.size() ||
+                    std::memcmp(recorded.arguments, arguments.data(), arguments.size()) != 0)
+                    continue;
+                std::size_t index = recorded.next < recorded.results.size() ? recorded.next++ : recorded.results.size() - 1;
+                result = recorded.results[index].first;
+                size = recorded.results[index].second;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Starts serving the recorded results from the first one again.
+         */
+        void rewind() {
+            for (auto &bucket : _index) {
+                for (auto &recorded : bucket.second)
+                    recorded.next = 0;
+            }
+        }
+
+        unsigned long long calls() const {
+            return _calls;
+        }
+    };
+
+    template<typename R, typename ... arglist>
+    void RecordDelegateValue<R, arglist...>::record(const ArgumentsTuple<arglist...> &args) {
+        _arguments.clear();
+        encodeTuple(_arguments, args);
+        _recorder.write(_channel, _arguments, _result);
+    }
+
+    template<typename R, typename ... arglist>
+    bool ReturnRecordedValue<R, arglist...>::find(const char *&result, std::uint32_t &size) {
+        return _player.find(_channel, _arguments, result, size);
+    }
+
+}
@@ -0,0 +1,195 @@
+/*
+ * CheckFunctor.hpp
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "fakeit/Sequence.hpp"
+#include "fakeit/SortInvocations.hpp"
+#include "fakeit/MatchAnalysis.hpp"
+#include "fakeit/FakeitEvents.hpp"
+#include "fakeit/Quantifier.hpp"
+#include "mockutils/to_string.hpp"
+
+namespace fakeit {
+
+    /**
+     * The outcome of a Check(...) expectation.
+     * Unlike Verify, a failed check does not throw and does not build a verification event.
+     */
+    class VerificationResult {
+        bool _ok;
+        VerificationType _type;
+        int _expectedCount;
+        int _expectedMaxCount;
+        int _actualCount;
+
+    public:
+
+        VerificationResult(bool ok, VerificationType type, int expectedCount, int actualCount,
+                           int expectedMaxCount = -1) :
+                _ok(ok), _type(type), _expectedCount(expectedCount), _expectedMaxCount(expectedMaxCount),
+                _actualCount(actualCount) {
+        }
+
+        bool ok() const {
+            return _ok;
+        }
+
+        VerificationType verificationType() const {
+            return _type;
+        }
+
+        int expectedCount() const {
+            return _expectedCount;
+        }
+
+        /**
+         * The upper bound of the expected count, -1 when there is none (AtLeast).
+         */
+        int expectedMaxCount() const {
+            return _expectedMaxCount;
+        }
+
+        /**
+         * AtMost and Between stop counting at the first match over expectedMaxCount().
+         */
+        int actualCount() const {
+            return _actualCount;
+        }
+
+        explicit operator bool() const {
+            return _ok;
+        }
+
+        bool operator!() const {
+            return !_ok;
+        }
+    };
+
+    class CheckProgress {
+
+        InvocationsSourceProxy _sources;
+        std::vector<Sequence *> _expectedPattern;
+
+        static void checkArgument(const int times) {
+            if (times < 0) {
+                throw std::invalid_argument(std::string("bad argument times:").append(fakeit::to_string(times)));
+            }
+        }
+
+        // a negative maxCount leaves the range open ended, as in SequenceVerificationExpectation.
+        VerificationResult check(VerificationType type, const int minCount, const int maxCount) {
+            bool stopOverLimit = type == VerificationType::AtMost || type == VerificationType::Between;
+            MatchAnalysis ma;
+            ma.run(_sources, _expectedPattern, stopOverLimit ? maxCount : -1);
+            bool ok = ma.count >= minCount && (maxCount < 0 || ma.count <= maxCount);
+            if (ok) {
+                for (auto i : ma.matchedInvocations) {
+                    i->markAsVerified();
+                }
+            }
+            return VerificationResult(ok, type, minCount, ma.count, maxCount);
+        }
+
+    public:
+
+        CheckProgress(InvocationsSourceProxy sources, const std::vector<Sequence *> &expectedPattern) :
+                _sources(sources), _expectedPattern(expectedPattern) {
+        }
+
+        explicit operator bool() {
+            return AtLeastOnce().ok();
+        }
+
+        bool operator!() {
+            return !AtLeastOnce().ok();
+        }
+
+        VerificationResult Never() {
+            return Exactly(0);
+        }
+
+        VerificationResult Once() {
+            return Exactly(1);
+        }
+
+        VerificationResult Twice() {
+            return Exactly(2);
+        }
+
+        VerificationResult AtLeastOnce() {
+            return check(VerificationType::AtLeast, 1, -1);
+        }
+
+        VerificationResult Exactly(const int times) {
+            checkArgument(times);
+            return check(VerificationType::Exact, times, times);
+        }
+
+        VerificationResult Exactly(const Quantity &q) {
+            return Exactly(q.quantity);
+        }
+
+        VerificationResult AtLeast(const int times) {
+            checkArgument(times);
+            return check(VerificationType::AtLeast, times, -1);
+        }
+
+        VerificationResult AtLeast(const Quantity &q) {
+            return AtLeast(q.quantity);
+        }
+
+        VerificationResult AtMost(const int times) {
+            checkArgument(times);
+            return check(VerificationType::AtMost, 0, times);
+        }
+
+        VerificationResult AtMost(const Quantity &q) {
+            return AtMost(q.quantity);
+        }
+
+        VerificationResult Between(const int minTimes, const int maxTimes) {
+            checkArgument(minTimes);
+            if (maxTimes < minTimes) {
+                throw std::invalid_argument(std::string("bad argument times:").append(fakeit::to_string(minTimes))
+                                                    .append("..").append(fakeit::to_string(maxTimes)));
+            }
+            return check(VerificationType::Between, minTimes, maxTimes);
+        }
+
+        VerificationResult Between(const Quantity &minQ, const Quantity &maxQ) {
+            return Between(minQ.quantity, maxQ.quantity);
+        }
+    };
+
+    /**
+     * Check(...) takes the same sequences as Verify(...), but the quantifiers return a VerificationResult
+     * instead of reporting a failure to the testing framework. Matched invocations are marked as verified on success.
+     */
+    class CheckFunctor {
+
+    public:
+
+        template<typename ... list>
+        CheckProgress operator()(const Sequence &sequence, const list &... tail) {
+            std::vector<Sequence *> allSequences{&InvocationUtils::remove_const(sequence),
+                                                 &InvocationUtils::remove_const(tail)...};
+
+            std::vector<ActualInvocationsSource *> involvedSources;
+            InvocationUtils::collectInvolvedMocks(allSequences, involvedSources);
+            InvocationsSourceProxy aggregateInvocationsSource{new AggregateInvocationsSource(involvedSources)};
+            return CheckProgress(aggregateInvocationsSource, allSequences);
+        }
+
+    };
+
+}
@@ -0,0 +1,188 @@
+/*
+ * ChromeTraceWriter.hpp
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "fakeit/EventHandler.hpp"
+#include "fakeit/FakeitContext.hpp"
+#include "fakeit/FakeitEvents.hpp"
+#include "mockutils/BufferFormatter.hpp"
+
+namespace fakeit {
+
+    /**
+     * Streams the mocked calls to a file in the Chrome Trace Event format (JSON array), which chrome://tracing
+     * and Perfetto open. Each call is a complete ("X") event named after the method, on the thread that made it,
+     * that lasts from the moment the call reached the mock until the behavior (stub, spied original...) returned
+     * or threw. A call made by a stub shows nested in the call of that stub.
+     *
+     *   ChromeTraceWriter trace("calls.json"); // traces the calls until it is closed or destroyed
+     *   ...
+     *
+     * Events are written through a buffer of a fixed size, so tracing millions of calls does not hold them in memory.
+     * Like the mocks themselves, the writer is not synchronized.
+     * Not included by fakeit.hpp: include it after fakeit.hpp or fakeit_core.hpp.
+     */
+    class ChromeTraceWriter : public InvocationEventHandler {
+
+        typedef std::chrono::steady_clock clock;
+
+        struct StartedCall {
+            unsigned int ordinal;
+            clock::time_point start;
+        };
+
+        FakeitContext &_fakeit;
+        std::FILE *_file;
+        std::string _buffer;
+        std::size_t _bufferSize;
+        unsigned long long _events;
+        clock::time_point _origin;
+        std::vector<StartedCall> _startedCalls;
+        std::vector<std::thread::id> _threads;
+
+        ChromeTraceWriter(const ChromeTraceWriter &) = delete;
+
+        ChromeTraceWriter &operator=(const ChromeTraceWriter &) = delete;
+
+        // small thread numbers read better in the viewers than hashed thread ids.
+        std::size_t threadNumber() {
+            std::thread::id id = std::this_thread::get_id();
+            for (std::size_t i = 0; i < _threads.size(); i++) {
+                if (_threads[i] == id)
+                    return i + 1;
+            }
+            _threads.push_back(id);
+            return _threads.size();
+        }
+
+        // microseconds, with the nanoseconds as a fraction.
+        static void appendMicros(std::string &out, clock::duration duration) {
+            unsigned long long nanos = (unsigned long long) std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    duration).count();
+            internal::appendUnsigned(out, nanos / 1000);
+            unsigned long long fraction = nanos % 1000;
+            char digits[4] = {'.', char('0' + fraction / 100), char('0' + fraction / 10 % 10), char('0' + fraction % 10)};
+            out.append(digits, sizeof(digits));
+        }
+
+        static void appendEscaped(std::string &out, const std::string &text) {
+            for (char c : text) {
+                if (c == '"' || c == '\\') {
+                    out += '\\';
+                    out += c;
+                } else if ((unsigned char) c < 0x20) {
+                    out += ' ';
+                } else {
+                    out += c;
+                }
+            }
+        }
+
+        void writeEvent(const InvocationEvent &e, clock::time_point start, clock::time_point end) {
+            _buffer += _events ? ",\n" : "\n";
+            _buffer += "{\"name\":\"";
+            appendEscaped(_buffer, e.getMethod().name());
+            _buffer += "\",\"cat\":\"fakeit\",\"ph\":\"X\",\"ts\":";
+            appendMicros(_buffer, start - _origin);
+            _buffer += ",\"dur\":";
+            appendMicros(_buffer, end - start);
+            _buffer += ",\"pid\":1,\"tid\":";
+            internal::appendUnsigned(_buffer, threadNumber());
+            _buffer += ",\"args\":{\"ordinal\":";
+            internal::appendUnsigned(_buffer, e.getOrdinal());
+            _buffer += "}}";
+            _events++;
+            if (_buffer.size() >= _bufferSize)
+                writeBuffer();
+        }
+
+        void writeBuffer() {
+            std::fwrite(_buffer.data(), 1, _buffer.size(), _file);
+            _buffer.clear();
+        }
+
+    public:
+
+        static const std::size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+        ChromeTraceWriter(const std::string &path, std::size_t bufferSize = DEFAULT_BUFFER_SIZE) :
+                ChromeTraceWriter(Fakeit, path, bufferSize) {
+        }
+
+        ChromeTraceWriter(FakeitContext &fakeit, const std::string &path,
+                          std::size_t bufferSize = DEFAULT_BUFFER_SIZE) :
+                _fakeit(fakeit), _file(std::fopen(path.c_str(), "wb")), _bufferSize(bufferSize), _events(0),
+                _origin(clock::now()) {
+            if (!_file) {
+                throw std::runtime_error(std::string("can't open trace file: ").append(path));
+            }
+            // the events are buffered here already.
+            std::setvbuf(_file, nullptr, _IONBF, 0);
+            _buffer.reserve(bufferSize + 256);
+            _buffer += "[";
+            _fakeit.addInvocationEventHandler(*this);
+        }
+
+        virtual ~ChromeTraceWriter() {
+            close();
+        }
+
+        /**
+         * Writes the buffered events to the file.
+         */
+        void flush() {
+            if (!_file)
+                return;
+            writeBuffer();
+            std::fflush(_file);
+        }
+
+        /**
+         * Stops tracing, completes the JSON array and closes the file. Calls that did not complete yet are not written.
+         */
+        void close() {
+            if (!_file)
+                return;
+            _fakeit.removeInvocationEventHandler(*this);
+            _buffer += "\n]\n";
+            writeBuffer();
+            std::fclose(_file);
+            _file = nullptr;
+        }
+
+        unsigned long long events() const {
+            return _events;
+        }
+
+        virtual void handle(const InvocationEvent &e) override {
+            _startedCalls.push_back(StartedCall{e.getOrdinal(), clock::now()});
+        }
+
+        virtual void handleCompletion(const InvocationEvent &e) override {
+            clock::time_point end = clock::now();
+            // usually the innermost call. Calls that started before the writer was added are not found.
+            for (std::size_t i = _startedCalls.size(); i-- > 0;) {
+                if (_startedCalls[i].ordinal == e.getOrdinal()) {
+                    if (_file)
+                        writeEvent(e, _startedCalls[i].start, end);
+                    _startedCalls.erase(_startedCalls.begin() + i);
+                    return;
+                }
+            }
+        }
+    };
+
+}
@@ -7,24 +7,28 @@
  */
 #pragma once
 
-#include <iosfwd>
+#include <string>
+#include <type_traits>
+#include <vector>
 #include "fakeit/EventFormatter.hpp"
 #include "fakeit/FakeitEvents.hpp"
+#include "mockutils/BufferFormatter.hpp"
 
 namespace fakeit {
 
     struct DefaultEventFormatter : public EventFormatter {
 
         virtual std::string format(const UnexpectedMethodCallEvent &e) override {
-            std::ostringstream out;
-            out << "Unexpected method invocation: ";
-            out << e.getInvocation().format() << std::endl;
+            std::string out;
+            out += "Unexpected method invocation: ";
+            e.getInvocation().formatTo(out);
+            out += '\n';
             if (UnexpectedType::Unmatched == e.getUnexpectedType()) {
-                out << "  Could not find Any recorded behavior to support this method call.";
+                out += "  Could not find Any recorded behavior to support this method call.";
             } else {
-                out << "  An unmocked method was invoked. All used virtual methods must be stubbed!";
+                out += "  An unmocked method was invoked. All used virtual methods must be stubbed!";
             }
-            return out.str();
+            return out;
         }
 
         /*
@@ -35,41 +39,62 @@ namespace fakeit {
          Actual sequence : no actual invocations
          */
         virtual std::string format(const SequenceVerificationEvent &e) override {
-            std::ostringstream out;
-            out << "Verification error" << std::endl;
+            std::string out;
+            out += "Verification error\n";
 
-            out << "Expected pattern: ";
-            const std::vector<fakeit::Sequence *> expectedPattern = e.expectedPattern();
-            out << formatExpectedPattern(expectedPattern) << std::endl;
+            out += "Expected pattern: ";
+            EventListView<fakeit::Sequence *> expectedPattern = e.expectedPattern();
+            out += formatExpectedPattern(expectedPattern);
+            out += '\n';
 
-            out << "Expected matches: ";
-            formatExpectedCount(out, e.verificationType(), e.expectedCount());
-            out << std::endl;
+            out += "Expected matches: ";
+            formatExpectedCount(out, e);
+            out += '\n';
 
-            out << "Actual matches  : " << e.actualCount() << std::endl;
+            out += "Actual matches  : ";
+            formatActualCount(out, e);
+            out += '\n';
 
-            auto actualSequence = e.actualSequence();
-            out << "Actual sequence : total of " << actualSequence.size() << " actual invocations";
+            unsigned int expectedSize = expectedPattern.empty() ? 0 : expectedPattern[0]->size();
+            if (e.closestMatchLength() > 0 && (unsigned int) e.closestMatchLength() < expectedSize) {
+                out += "Closest match   : ";
+                appendNumber(out, e.closestMatchLength());
+                out += " of ";
+                appendNumber(out, expectedSize);
+                out += " expected invocations, from actual invocation #";
+                appendNumber(out, e.closestMatchStart() + 1);
+                out += '\n';
+            }
+
+            EventListView<fakeit::Invocation *> actualSequence = e.actualSequence();
+            out += "Actual sequence : total of ";
+            appendNumber(out, actualSequence.size());
+            out += " actual invocations";
             if (actualSequence.size() == 0) {
-                out << ".";
+                out += ".";
             } else {
-                out << ":" << std::endl;
+                out += ":\n";
             }
-            formatInvocationList(out, actualSequence);
+            formatInvocationList(out, actualSequence, e.closestMatchStart() > 0 ? e.closestMatchStart() : 0);
 
-            return out.str();
+            return out;
         }
 
         virtual std::string format(const NoMoreInvocationsVerificationEvent &e) override {
-            std::ostringstream out;
-            out << "Verification error" << std::endl;
-            out << "Expected no more invocations!! But the following unverified invocations were found:" << std::endl;
+            std::string out;
+            out += "Verification error\n";
+            out += "Expected no more invocations!! But the following unverified invocations were found:\n";
             formatInvocationList(out, e.unverifedIvocations());
-            return out.str();
+            return out;
         }
 
     private:
 
+        template<typename T>
+        static void appendNumber(std::string &out, T value) {
+            internal::appendInteger(out, value, std::is_signed<T>());
+        }
+
         static std::string formatSequence(const Sequence &val) {
             const ConcatenatedSequence *cs = dynamic_cast<const ConcatenatedSequence *>(&val);
             if (cs) {
@@ -86,55 +111,141 @@ namespace fakeit {
             return vec[0]->format();
         }
 
-        static void formatExpectedCount(std::ostream &out, fakeit::VerificationType verificationType,
-                                        int expectedCount) {
-            if (verificationType == fakeit::VerificationType::Exact)
-                out << "exactly ";
+        static void formatExpectedCount(std::string &out, const SequenceVerificationEvent &e) {
+            if (e.verificationType() == fakeit::VerificationType::Exact)
+                out += "exactly ";
+
+            if (e.verificationType() == fakeit::VerificationType::AtLeast)
+                out += "at least ";
 
-            if (verificationType == fakeit::VerificationType::AtLeast)
-                out << "at least ";
+            if (e.verificationType() == fakeit::VerificationType::AtMost) {
+                out += "at most ";
+                appendNumber(out, e.expectedMaxCount());
+                return;
+            }
+
+            if (e.verificationType() == fakeit::VerificationType::Between) {
+                out += "between ";
+                appendNumber(out, e.expectedCount());
+                out += " and ";
+                appendNumber(out, e.expectedMaxCount());
+                return;
+            }
 
-            out << expectedCount;
+            appendNumber(out, e.expectedCount());
         }
 
-        static void formatInvocationList(std::ostream &out, const std::vector<fakeit::Invocation *> &actualSequence) {
-            size_t max_size = actualSequence.size();
-            if (max_size > 5)
-                max_size = 5;
-
-            for (unsigned int i = 0; i < max_size; i++) {
-                out << "  ";
-                auto invocation = actualSequence[i];
-                out << invocation->format();
-                if (i < max_size - 1)
-                    out << std::endl;
+        // AtMost and Between stop counting once over the limit.
+        static void formatActualCount(std::string &out, const SequenceVerificationEvent &e) {
+            bool stoppedOverLimit = e.verificationType() == fakeit::VerificationType::AtMost ||
+                                    e.verificationType() == fakeit::VerificationType::Between;
+            if (stoppedOverLimit && e.actualCount() > e.expectedMaxCount()) {
+                out += "more than ";
+                appendNumber(out, e.expectedMaxCount());
+                return;
             }
+            appendNumber(out, e.actualCount());
+        }
+
+        static const std::size_t MAX_LISTED_RUNS = 5;
+        static const std::size_t MAX_LISTED_RUNS_BEFORE = 2;
+        // how far from the anchor the runs are followed, each way, so huge uniform histories format fast.
+        static const std::size_t MAX_SCANNED_INVOCATIONS = 100;
 
-            if (actualSequence.size() > max_size)
-                out << std::endl << "  ...";
+        // consecutive invocations [begin, end) that format the same.
+        struct InvocationRun {
+            std::size_t begin;
+            std::size_t end;
+            std::string text;
+        };
+
+        static bool formatsAs(const Invocation &invocation, const Invocation &other, const std::string &otherText,
+                              std::string &buffer) {
+            if (&invocation.getMethod() != &other.getMethod())
+                return false;
+            buffer.clear();
+            invocation.formatTo(buffer);
+            return buffer == otherText;
+        }
+
+        // the run at index, cut at the window [first, last).
+        static InvocationRun invocationRunAt(const EventListView<fakeit::Invocation *> &actualSequence, std::size_t index,
+                                             std::size_t first, std::size_t last) {
+            InvocationRun run{index, index + 1, std::string()};
+            const Invocation &invocation = *actualSequence[index];
+            invocation.formatTo(run.text);
+            std::string buffer;
+            while (run.begin > first && formatsAs(*actualSequence[run.begin - 1], invocation, run.text, buffer))
+                run.begin--;
+            while (run.end < last && formatsAs(*actualSequence[run.end], invocation, run.text, buffer))
+                run.end++;
+            return run;
+        }
+
+        /**
+         * Lists up to MAX_LISTED_RUNS runs of identical invocations around the invocation at anchor,
+         * MAX_LISTED_RUNS_BEFORE of them before it when there are enough invocations after it.
+         * Only the invocations up to MAX_SCANNED_INVOCATIONS away from the anchor are looked at,
+         * the count of a run cut there is a lower bound.
+         */
+        static void formatInvocationList(std::string &out, const EventListView<fakeit::Invocation *> &actualSequence,
+                                         std::size_t anchor = 0) {
+            if (actualSequence.empty())
+                return;
+
+            std::size_t first = anchor > MAX_SCANNED_INVOCATIONS ? anchor - MAX_SCANNED_INVOCATIONS : 0;
+            std::size_t last = actualSequence.size() - anchor > MAX_SCANNED_INVOCATIONS ?
+                               anchor + MAX_SCANNED_INVOCATIONS + 1 : actualSequence.size();
+            std::vector<InvocationRun> runs{invocationRunAt(actualSequence, anchor, first, last)};
+            while (runs.size() <= MAX_LISTED_RUNS_BEFORE && runs.front().begin > first)
+                runs.insert(runs.begin(), invocationRunAt(actualSequence, runs.front().begin - 1, first, last));
+            while (runs.size() < MAX_LISTED_RUNS && runs.back().end < last)
+                runs.push_back(invocationRunAt(actualSequence, runs.back().end, first, last));
+            while (runs.size() < MAX_LISTED_RUNS && runs.front().begin > first)
+                runs.insert(runs.begin(), invocationRunAt(actualSequence, runs.front().begin - 1, first, last));
+
+            if (runs.front().begin > 0)
+                out += "  ...\n";
+            for (unsigned int i = 0; i < runs.size(); i++) {
+                out += "  ";
+                out += runs[i].text;
+                std::size_t times = runs[i].end - runs[i].begin;
+                bool isCut = (runs[i].begin == first && first > 0) || (runs[i].end == last && last < actualSequence.size());
+                if (times > 1) {
+                    out += isCut ? " (at least " : " (";
+                    appendNumber(out, times);
+                    out += " times)";
+                }
+                if (i < runs.size() - 1)
+                    out += '\n';
+            }
+            if (runs.back().end < actualSequence.size())
+                out += "\n  ...";
         }
 
         static std::string format(const ConcatenatedSequence &val) {
-            std::ostringstream out;
-            out << formatSequence(val.getLeft()) << " + " << formatSequence(val.getRight());
-            return out.str();
+            std::string out = formatSequence(val.getLeft());
+            out += " + ";
+            out += formatSequence(val.getRight());
+            return out;
         }
 
         static std::string format(const RepeatedSequence &val) {
-            std::ostringstream out;
+            std::string out;
             const ConcatenatedSequence *cs = dynamic_cast<const ConcatenatedSequence *>(&val.getSequence());
             const RepeatedSequence *rs = dynamic_cast<const RepeatedSequence *>(&val.getSequence());
             if (rs || cs)
-                out << '(';
-            out << formatSequence(val.getSequence());
+                out += '(';
+            out += formatSequence(val.getSequence());
             if (rs || cs)
-                out << ')';
+                out += ')';
 
-            out << " * " << val.getTimes();
-            return out.str();
+            out += " * ";
+            appendNumber(out, val.getTimes());
+            return out;
         }
 
-        static std::string formatExpectedPattern(const std::vector<fakeit::Sequence *> &expectedPattern) {
+        static std::string formatExpectedPattern(const EventListView<fakeit::Sequence *> &expectedPattern) {
             std::string expectedPatternStr;
             for (unsigned int i = 0; i < expectedPattern.size(); i++) {
                 Sequence *s = expectedPattern[i];
@@ -7,7 +7,6 @@
  */
 #include "fakeit/EventHandler.hpp"
 #include "fakeit/FakeitContext.hpp"
-#include "fakeit/DefaultEventLogger.hpp"
 #include "fakeit/DefaultEventFormatter.hpp"
 
 namespace fakeit {
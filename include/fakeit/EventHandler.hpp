@@ -23,4 +23,18 @@ namespace fakeit {
         virtual void handle(const UnexpectedMethodCallEvent &e) = 0;
     };
 
+    struct InvocationEventHandler {
+        virtual ~InvocationEventHandler() = default;
+
+        virtual void handle(const InvocationEvent &e) = 0;
+
+        /**
+         * Called when the call returns or throws, including calls whose handle(e) was not reached because
+         * an earlier handler threw. The arguments may have been moved out by then.
+         * An exception thrown here is ignored if the call itself threw.
+         */
+        virtual void handleCompletion(const InvocationEvent &) {
+        }
+    };
+
 }
@@ -8,12 +8,36 @@
 
 #pragma once
 
+#include <memory>
+#include <utility>
 #include <vector>
+#include "mockutils/Destructible.hpp"
 #include "fakeit/EventHandler.hpp"
 #include "fakeit/EventFormatter.hpp"
 
 namespace fakeit {
 
+    /**
+     * Something that answers calls without going through the method bodies (see Mock::DisableInvocationHistory).
+     * It is refreshed when the first invocation event handler is added and when the last one is removed,
+     * so that the handlers see every call.
+     */
+    struct InvocationShortcuts {
+        InvocationShortcuts() : _previousShortcuts(nullptr), _nextShortcuts(nullptr) {
+        }
+
+        virtual ~InvocationShortcuts() = default;
+
+        virtual void refreshInvocationShortcuts() = 0;
+
+    private:
+        friend struct FakeitContext;
+
+        // linked in the context, so that creating a mock does not allocate.
+        InvocationShortcuts *_previousShortcuts;
+        InvocationShortcuts *_nextShortcuts;
+    };
+
     struct FakeitContext : public EventHandler, protected EventFormatter {
 
         virtual ~FakeitContext() = default;
@@ -51,6 +75,13 @@ namespace fakeit {
             return eventFormatter.format(e);
         }
 
+        /**
+         * The context as a formatter, it formats with the event formatter that is set when format is called.
+         */
+        EventFormatter &asEventFormatter() {
+            return *this;
+        }
+
         void addEventHandler(EventHandler &eventListener) {
             _eventListeners.push_back(&eventListener);
         }
@@ -59,6 +90,85 @@ namespace fakeit {
             _eventListeners.clear();
         }
 
+        /**
+         * Observes every call of every mocked method. When no handler is added a call only pays for
+         * the hasInvocationEventHandlers() check.
+         */
+        void addInvocationEventHandler(InvocationEventHandler &invocationListener) {
+            _invocationListeners.push_back(&invocationListener);
+            if (_invocationListeners.size() == 1)
+                refreshInvocationShortcuts();
+        }
+
+        void removeInvocationEventHandler(InvocationEventHandler &invocationListener) {
+            bool hadListeners = hasInvocationEventHandlers();
+            for (auto it = _invocationListeners.begin(); it != _invocationListeners.end();) {
+                if (*it == &invocationListener)
+                    it = _invocationListeners.erase(it);
+                else
+                    ++it;
+            }
+            if (hadListeners && !hasInvocationEventHandlers())
+                refreshInvocationShortcuts();
+        }
+
+        void clearInvocationEventHandlers() {
+            bool hadListeners = hasInvocationEventHandlers();
+            _invocationListeners.clear();
+            if (hadListeners)
+                refreshInvocationShortcuts();
+        }
+
+        bool hasInvocationEventHandlers() const {
+            return !_invocationListeners.empty();
+        }
+
+        void notifyInvocation(const InvocationEvent &evt) {
+            for (auto listener : _invocationListeners)
+                listener->handle(evt);
+        }
+
+        void notifyInvocationCompletion(const InvocationEvent &evt) {
+            for (auto listener : _invocationListeners)
+                listener->handleCompletion(evt);
+        }
+
+        void addInvocationShortcuts(InvocationShortcuts &shortcuts) {
+            shortcuts._previousShortcuts = nullptr;
+            shortcuts._nextShortcuts = _invocationShortcuts;
+            if (_invocationShortcuts)
+                _invocationShortcuts->_previousShortcuts = &shortcuts;
+            _invocationShortcuts = &shortcuts;
+        }
+
+        void removeInvocationShortcuts(InvocationShortcuts &shortcuts) {
+            if (shortcuts._previousShortcuts)
+                shortcuts._previousShortcuts->_nextShortcuts = shortcuts._nextShortcuts;
+            else if (_invocationShortcuts == &shortcuts)
+                _invocationShortcuts = shortcuts._nextShortcuts;
+            if (shortcuts._nextShortcuts)
+                shortcuts._nextShortcuts->_previousShortcuts = shortcuts._previousShortcuts;
+            shortcuts._previousShortcuts = nullptr;
+            shortcuts._nextShortcuts = nullptr;
+        }
+
+        /**
+         * An object shared by the mocks of the context, nullptr if none was added with this key.
+         * Like the rest of the context it is not synchronized, the mocks of a context are created by one thread at a time.
+         */
+        Destructible *getSharedObject(const void *key) const {
+            for (auto &sharedObject : _sharedObjects) {
+                if (sharedObject.first == key)
+                    return sharedObject.second.get();
+            }
+            return nullptr;
+        }
+
+        // the context owns the object, it is deleted with the context.
+        void addSharedObject(const void *key, Destructible *object) {
+            _sharedObjects.emplace_back(key, std::unique_ptr<Destructible>(object));
+        }
+
     protected:
         virtual EventHandler &getTestingFrameworkAdapter() = 0;
 
@@ -66,6 +176,14 @@ namespace fakeit {
 
     private:
         std::vector<EventHandler *> _eventListeners;
+        std::vector<InvocationEventHandler *> _invocationListeners;
+        InvocationShortcuts *_invocationShortcuts = nullptr;
+        std::vector<std::pair<const void *, std::unique_ptr<Destructible>>> _sharedObjects;
+
+        void refreshInvocationShortcuts() {
+            for (InvocationShortcuts *shortcuts = _invocationShortcuts; shortcuts; shortcuts = shortcuts->_nextShortcuts)
+                shortcuts->refreshInvocationShortcuts();
+        }
 
         void fireEvent(const NoMoreInvocationsVerificationEvent &evt) {
             for (auto listener : _eventListeners)
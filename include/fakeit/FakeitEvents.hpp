@@ -7,8 +7,12 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <string>
+#include <typeinfo>
+#include <vector>
 
 #include "fakeit/Sequence.hpp"
 #include "fakeit/DomainObjects.hpp"
@@ -16,19 +20,66 @@
 namespace fakeit {
 
     enum class VerificationType {
-        Exact, AtLeast, NoMoreInvocations
+        Exact, AtLeast, AtMost, Between, NoMoreInvocations
     };
 
     enum class UnexpectedType {
         Unmocked, Unmatched
     };
 
+    /**
+     * A read only view of a list held by whoever fired an event. It does not own the elements and is valid
+     * only while the event is handled, copy them (see toVector) to keep them longer.
+     */
+    template<typename T>
+    class EventListView {
+    public:
+        EventListView(const std::vector<T> &elements) : _begin(elements.data()), _size(elements.size()) {
+        }
+
+        const T *begin() const {
+            return _begin;
+        }
+
+        const T *end() const {
+            return _begin + _size;
+        }
+
+        std::size_t size() const {
+            return _size;
+        }
+
+        bool empty() const {
+            return _size == 0;
+        }
+
+        const T &operator[](std::size_t index) const {
+            return _begin[index];
+        }
+
+        std::vector<T> toVector() const {
+            return std::vector<T>(begin(), end());
+        }
+
+    private:
+        const T *_begin;
+        std::size_t _size;
+    };
+
+    /**
+     * Events refer to the state of the verification or the call that fired them, they are valid only while
+     * they are handled. They cannot be copied, so that an event is not kept by mistake.
+     */
     struct VerificationEvent {
 
         VerificationEvent(VerificationType aVerificationType) :
                 _verificationType(aVerificationType), _line(0) {
         }
 
+        VerificationEvent(const VerificationEvent &) = delete;
+
+        VerificationEvent &operator=(const VerificationEvent &) = delete;
+
         virtual ~VerificationEvent() = default;
 
         VerificationType verificationType() const {
@@ -65,24 +116,24 @@ namespace fakeit {
         ~NoMoreInvocationsVerificationEvent() = default;
 
         NoMoreInvocationsVerificationEvent( //
-                std::vector<Invocation *> &allTheIvocations, //
-                std::vector<Invocation *> &anUnverifedIvocations) : //
+                const std::vector<Invocation *> &allTheIvocations, //
+                const std::vector<Invocation *> &anUnverifedIvocations) : //
                 VerificationEvent(VerificationType::NoMoreInvocations), //
                 _allIvocations(allTheIvocations), //
                 _unverifedIvocations(anUnverifedIvocations) { //
         }
 
-        const std::vector<Invocation *> &allIvocations() const {
+        EventListView<Invocation *> allIvocations() const {
             return _allIvocations;
         }
 
-        const std::vector<Invocation *> &unverifedIvocations() const {
+        EventListView<Invocation *> unverifedIvocations() const {
             return _unverifedIvocations;
         }
 
     private:
-        const std::vector<Invocation *> _allIvocations;
-        const std::vector<Invocation *> _unverifedIvocations;
+        const EventListView<Invocation *> _allIvocations;
+        const EventListView<Invocation *> _unverifedIvocations;
     };
 
     struct SequenceVerificationEvent : public VerificationEvent {
@@ -90,39 +141,76 @@ namespace fakeit {
         ~SequenceVerificationEvent() = default;
 
         SequenceVerificationEvent(VerificationType aVerificationType, //
-                                  std::vector<Sequence *> &anExpectedPattern, //
-                                  std::vector<Invocation *> &anActualSequence, //
+                                  const std::vector<Sequence *> &anExpectedPattern, //
+                                  const std::vector<Invocation *> &anActualSequence, //
                                   int anExpectedCount, //
-                                  int anActualCount) : //
+                                  int anActualCount, //
+                                  int aClosestMatchStart = -1, //
+                                  int aClosestMatchLength = 0, //
+                                  int anExpectedMaxCount = -1) : //
                 VerificationEvent(aVerificationType), //
                 _expectedPattern(anExpectedPattern), //
                 _actualSequence(anActualSequence), //
                 _expectedCount(anExpectedCount), //
-                _actualCount(anActualCount) //
+                _actualCount(anActualCount), //
+                _closestMatchStart(aClosestMatchStart), //
+                _closestMatchLength(aClosestMatchLength), //
+                _expectedMaxCount(anExpectedMaxCount) //
         { //
         }
 
-        const std::vector<Sequence *> &expectedPattern() const {
+        EventListView<Sequence *> expectedPattern() const {
             return _expectedPattern;
         }
 
-        const std::vector<Invocation *> &actualSequence() const {
+        EventListView<Invocation *> actualSequence() const {
             return _actualSequence;
         }
 
+        /**
+         * The expected count, or the lower bound for AtMost (0) and Between.
+         */
         int expectedCount() const {
             return _expectedCount;
         }
 
+        /**
+         * The upper bound of the expected count, -1 when there is none (AtLeast).
+         */
+        int expectedMaxCount() const {
+            return _expectedMaxCount;
+        }
+
+        /**
+         * AtMost and Between stop counting at the first match over expectedMaxCount(),
+         * so for them actualCount() is never more than expectedMaxCount() + 1.
+         */
         int actualCount() const {
             return _actualCount;
         }
 
+        /**
+         * Index in actualSequence() where the first expected sequence came closest to matching, -1 if nowhere.
+         */
+        int closestMatchStart() const {
+            return _closestMatchStart;
+        }
+
+        /**
+         * How many invocations of the first expected sequence matched at closestMatchStart().
+         */
+        int closestMatchLength() const {
+            return _closestMatchLength;
+        }
+
     private:
-        const std::vector<Sequence *> _expectedPattern;
-        const std::vector<Invocation *> _actualSequence;
+        const EventListView<Sequence *> _expectedPattern;
+        const EventListView<Invocation *> _actualSequence;
         const int _expectedCount;
         const int _actualCount;
+        const int _closestMatchStart;
+        const int _closestMatchLength;
+        const int _expectedMaxCount;
     };
 
     struct UnexpectedMethodCallEvent {
@@ -130,6 +218,10 @@ namespace fakeit {
                 _unexpectedType(unexpectedType), _invocation(invocation) {
         }
 
+        UnexpectedMethodCallEvent(const UnexpectedMethodCallEvent &) = delete;
+
+        UnexpectedMethodCallEvent &operator=(const UnexpectedMethodCallEvent &) = delete;
+
         const Invocation &getInvocation() const {
             return _invocation;
         }
@@ -142,4 +234,65 @@ namespace fakeit {
         const Invocation &_invocation;
     };
 
+
+    /**
+     * A type erased view of the arguments of an invocation.
+     */
+    struct InvocationArguments {
+
+        virtual ~InvocationArguments() = default;
+
+        virtual std::size_t size() const = 0;
+
+        // the type of the argument, without reference and cv qualifiers.
+        virtual const std::type_info &type(std::size_t index) const = 0;
+
+        virtual const void *address(std::size_t index) const = 0;
+
+        // appends "(arg1, arg2, ...)" to out.
+        virtual void formatTo(std::string &out) const = 0;
+
+        // the argument if it is of type T, nullptr otherwise.
+        template<typename T>
+        const T *get(std::size_t index) const {
+            if (index >= size() || type(index) != typeid(T))
+                return nullptr;
+            return static_cast<const T *>(address(index));
+        }
+    };
+
+    /**
+     * Fired on every call of a mocked method, before its behavior is selected.
+     * The event and its arguments are valid only while the event is handled.
+     */
+    struct InvocationEvent {
+        InvocationEvent(const Invocation &invocation, const InvocationArguments &arguments) :
+                _invocation(invocation), _arguments(arguments) {
+        }
+
+        InvocationEvent(const InvocationEvent &) = delete;
+
+        InvocationEvent &operator=(const InvocationEvent &) = delete;
+
+        const Invocation &getInvocation() const {
+            return _invocation;
+        }
+
+        const MethodInfo &getMethod() const {
+            return _invocation.getMethod();
+        }
+
+        unsigned int getOrdinal() const {
+            return _invocation.getOrdinal();
+        }
+
+        const InvocationArguments &getArguments() const {
+            return _arguments;
+        }
+
+    private:
+        const Invocation &_invocation;
+        const InvocationArguments &_arguments;
+    };
+
 }
@@ -7,7 +7,11 @@
  */
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include "fakeit/FakeitEvents.hpp"
+#include "fakeit/EventFormatter.hpp"
 
 namespace fakeit {
     
@@ -30,15 +34,36 @@ namespace fakeit {
     struct UnexpectedMethodCallException : public FakeitException {
 
         UnexpectedMethodCallException(std::string format) :
-                _format(format) {
+                _format(format), _formatter(nullptr), _unexpectedType(UnexpectedType::Unmatched) {
+        }
+
+        /**
+         * The message is only formatted when what() is called, so an exception that is caught and discarded
+         * costs no formatting at all. The invocation is copied into the exception (see Invocation::copy()),
+         * as the mock and the arguments are usually gone by the time what() is called.
+         */
+        UnexpectedMethodCallException(EventFormatter &formatter, const UnexpectedMethodCallEvent &event) :
+                _formatter(&formatter),
+                _unexpectedType(event.getUnexpectedType()),
+                _invocation(event.getInvocation().copy()) {
         }
 
         virtual std::string what() const override {
+            if (_formatter) {
+                UnexpectedMethodCallEvent event(_unexpectedType, *_invocation);
+                _format = _formatter->format(event);
+                _formatter = nullptr;
+                _invocation = nullptr;
+            }
             return _format;
         }
 
     private:
-        std::string _format;
+
+        mutable std::string _format;
+        mutable EventFormatter *_formatter;
+        UnexpectedType _unexpectedType;
+        mutable std::shared_ptr<const Invocation> _invocation;
     };
 
 }
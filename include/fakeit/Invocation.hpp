@@ -7,11 +7,11 @@
  */
 #pragma once
 
+#include <memory>
 #include <typeinfo>
 #include <tuple>
 #include <string>
 #include <iosfwd>
-#include <sstream>
 
 #include "fakeit/DomainObjects.hpp"
 #include "mockutils/Destructible.hpp"
@@ -59,6 +59,17 @@ namespace fakeit {
 
         virtual std::string format() const = 0;
 
+        // appends the formatted invocation to out, overridden to skip the temporary string.
+        virtual void formatTo(std::string &out) const {
+            out += format();
+        }
+
+        /**
+         * A copy that refers to nothing outside of itself, so it can be formatted after the mock and the
+         * arguments are gone. The arguments are copied, not formatted.
+         */
+        virtual std::shared_ptr<Invocation> copy() const = 0;
+
     private:
         const unsigned int _ordinal;
         MethodInfo &_method;
@@ -12,13 +12,31 @@ namespace fakeit {
         std::vector<Invocation *> actualSequence;
         std::vector<Invocation *> matchedInvocations;
         int count;
+        int lastMatchStart = -1;
+        int closestMatchStart = -1;
+        int closestMatchLength = 0;
 
-        void run(InvocationsSourceProxy &involvedInvocationSources, std::vector<Sequence *> &expectedPattern) {
+        /**
+         * Counts the matches of the pattern. With a non negative maxCount, counting stops at the first match
+         * over it (count is then maxCount + 1 and lastMatchStart is where that match starts).
+         * The same pass finds where the first expected sequence came closest to matching: the start of its longest
+         * matched prefix (the first one on ties). closestMatchStart is -1 when no invocation matches at all.
+         */
+        void run(InvocationsSourceProxy &involvedInvocationSources, std::vector<Sequence *> &expectedPattern,
+                 int maxCount = -1) {
             getActualInvocationSequence(involvedInvocationSources, actualSequence);
-            count = countMatches(expectedPattern, actualSequence, matchedInvocations);
+            ClosestMatch closest;
+            count = countMatches(expectedPattern, actualSequence, matchedInvocations, maxCount, lastMatchStart, closest);
+            closestMatchStart = closest.start;
+            closestMatchLength = closest.length;
         }
 
     private:
+        struct ClosestMatch {
+            int start = -1;
+            int length = 0;
+        };
+
         static void getActualInvocationSequence(InvocationsSourceProxy &involvedMocks,
                                                 std::vector<Invocation *> &actualSequence) {
             std::unordered_set<Invocation *> actualInvocations;
@@ -27,11 +45,14 @@ namespace fakeit {
         }
 
         static int countMatches(std::vector<Sequence *> &pattern, std::vector<Invocation *> &actualSequence,
-                                std::vector<Invocation *> &matchedInvocations) {
+                                std::vector<Invocation *> &matchedInvocations, int maxCount, int &lastMatchStart,
+                                ClosestMatch &closest) {
             int end = -1;
             int count = 0;
             int startSearchIndex = 0;
-            while (findNextMatch(pattern, actualSequence, startSearchIndex, end, matchedInvocations)) {
+            while ((maxCount < 0 || count <= maxCount) &&
+                   findNextMatch(pattern, actualSequence, startSearchIndex, end, matchedInvocations, lastMatchStart,
+                                 closest)) {
                 count++;
                 startSearchIndex = end;
             }
@@ -45,16 +66,23 @@ namespace fakeit {
 
         static bool findNextMatch(std::vector<Sequence *> &pattern, std::vector<Invocation *> &actualSequence,
                                   int startSearchIndex, int &end,
-                                  std::vector<Invocation *> &matchedInvocations) {
+                                  std::vector<Invocation *> &matchedInvocations, int &start, ClosestMatch &closest) {
+            int matchStart = -1;
             for (auto sequence : pattern) {
-                int index = findNextMatch(sequence, actualSequence, startSearchIndex);
+                // only the first sequence of the pattern is reported as the closest match.
+                int index = findNextMatch(sequence, actualSequence, startSearchIndex,
+                                          matchStart == -1 ? &closest : nullptr);
                 if (index == -1) {
                     return false;
                 }
+                if (matchStart == -1) {
+                    matchStart = index;
+                }
                 collectMatchedInvocations(actualSequence, matchedInvocations, index, sequence->size());
                 startSearchIndex = index + sequence->size();
             }
             end = startSearchIndex;
+            start = matchStart;
             return true;
         }
 
@@ -69,22 +97,31 @@ namespace fakeit {
         }
 
 
-        static bool isMatch(std::vector<Invocation *> &actualSequence,
-                            std::vector<Invocation::Matcher *> &expectedSequence, int start) {
-            bool found = true;
-            for (unsigned int j = 0; found && j < expectedSequence.size(); j++) {
-                Invocation *actual = actualSequence[start + j];
-                Invocation::Matcher *expected = expectedSequence[j];
-                found = found && expected->matches(*actual);
+        // the number of leading expected invocations matched from start on.
+        static int matchLength(std::vector<Invocation *> &actualSequence,
+                               std::vector<Invocation::Matcher *> &expectedSequence, int start) {
+            int length = 0;
+            while (length < (int) expectedSequence.size() && start + length < (int) actualSequence.size() &&
+                   expectedSequence[length]->matches(*actualSequence[start + length])) {
+                length++;
             }
-            return found;
+            return length;
         }
 
-        static int findNextMatch(Sequence *&pattern, std::vector<Invocation *> &actualSequence, int startSearchIndex) {
+        static int findNextMatch(Sequence *&pattern, std::vector<Invocation *> &actualSequence, int startSearchIndex,
+                                 ClosestMatch *closest) {
             std::vector<Invocation::Matcher *> expectedSequence;
             pattern->getExpectedSequence(expectedSequence);
-            for (int i = startSearchIndex; i < ((int) actualSequence.size() - (int) expectedSequence.size() + 1); i++) {
-                if (isMatch(actualSequence, expectedSequence, i)) {
+            int expectedSize = (int) expectedSequence.size();
+            // a partial match may start too close to the end to ever be completed.
+            int lastStart = (int) actualSequence.size() - (closest ? 1 : expectedSize);
+            for (int i = startSearchIndex; i <= lastStart; i++) {
+                int length = matchLength(actualSequence, expectedSequence, i);
+                if (closest && length > closest->length) {
+                    closest->start = i;
+                    closest->length = length;
+                }
+                if (length == expectedSize) {
                     return i;
                 }
             }
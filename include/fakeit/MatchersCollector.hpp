@@ -13,6 +13,7 @@
 #include <memory>
 #include <vector>
 #include <unordered_set>
+#include <string>
 
 #include "mockutils/Destructible.hpp"
 #include "mockutils/type_utils.hpp"
@@ -20,7 +21,11 @@
 
 namespace fakeit {
 
-    template<unsigned int index, typename ... arglist>
+    /**
+     * Creates one matcher per argument. A value is matched with Eq, _ with Any,
+     * and a matcher creator creates its own matcher.
+     */
+    template<typename ... arglist>
     class MatchersCollector {
 
         std::vector<Destructible *> &_matchers;
@@ -32,72 +37,143 @@ namespace fakeit {
         using ArgType = typename std::tuple_element<N, std::tuple<arglist...>>::type;
 
         template<std::size_t N>
-        using NakedArgType = typename naked_type<ArgType<index>>::type;
-
-        template<std::size_t N>
-        using ArgMatcherCreatorType = decltype(std::declval<TypedMatcherCreator<NakedArgType<N>>>());
+        using NakedArgType = typename naked_type<ArgType<N>>::type;
 
         MatchersCollector(std::vector<Destructible *> &matchers)
                 : _matchers(matchers) {
         }
 
-        void CollectMatchers() {
+        template<typename ... matcherCreators>
+        void CollectMatchers(const matcherCreators &... matcherCreator) {
+            static_assert(sizeof...(matcherCreators) == sizeof...(arglist), "a matcher is required for each argument");
+            _matchers.reserve(_matchers.size() + sizeof...(arglist));
+            collectMatchers(make_index_sequence<sizeof...(arglist)>(), matcherCreator...);
         }
 
-        template<typename Head>
-        typename std::enable_if< //
-                std::is_constructible<NakedArgType<index>, Head>::value, void> //
-        ::type CollectMatchers(const Head &value) {
+    private:
+
+        template<std::size_t ... I, typename ... matcherCreators>
+        void collectMatchers(index_sequence<I...>, const matcherCreators &... matcherCreator) {
+#ifdef FAKEIT_CPP17
+            (_matchers.push_back(createMatcher<NakedArgType<I>>(matcherCreator)), ...);
+#else
+            int expand[] = {0, (_matchers.push_back(createMatcher<NakedArgType<I>>(matcherCreator)), 0)...};
+            (void) expand;
+#endif
+        }
 
-            TypedMatcher<NakedArgType<index>> *d = Eq<NakedArgType<index>>(value).createMatcher();
-            _matchers.push_back(d);
+        template<typename T, typename Head>
+        static typename std::enable_if< //
+                std::is_constructible<T, Head>::value, TypedMatcher<T> *> //
+        ::type createMatcher(const Head &value) {
+            return Eq<T>(value).createMatcher();
         }
 
-        template<typename Head, typename ...Tail>
-        typename std::enable_if< //
-                std::is_constructible<NakedArgType<index>, Head>::value //
-                , void> //
-        ::type CollectMatchers(const Head &head, const Tail &... tail) {
-            CollectMatchers(head);
-            MatchersCollector<index + 1, arglist...> c(_matchers);
-            c.CollectMatchers(tail...);
+        template<typename T, typename Head>
+        static typename std::enable_if< //
+                std::is_base_of<TypedMatcherCreator<T>, Head>::value, TypedMatcher<T> *> //
+        ::type createMatcher(const Head &creator) {
+            return creator.createMatcher();
         }
 
-        template<typename Head>
-        typename std::enable_if< //
-                std::is_base_of<TypedMatcherCreator<NakedArgType<index>>, Head>::value, void> //
-        ::type CollectMatchers(const Head &creator) {
-            TypedMatcher<NakedArgType<index>> *d = creator.createMatcher();
-            _matchers.push_back(d);
+        template<typename T, typename Head>
+        static typename std::enable_if< //
+                std::is_same<AnyMatcher, Head>::value, TypedMatcher<T> *> //
+        ::type createMatcher(const Head &) {
+            return Any<T>().createMatcher();
         }
 
-        template<typename Head, typename ...Tail>
-        //
-        typename std::enable_if< //
-                std::is_base_of<TypedMatcherCreator<NakedArgType<index>>, Head>::value, void> //
-        ::type CollectMatchers(const Head &head, const Tail &... tail) {
-            CollectMatchers(head);
-            MatchersCollector<index + 1, arglist...> c(_matchers);
-            c.CollectMatchers(tail...);
+    };
+
+    /**
+     * Holds a matcher of a creator that has no createInlineMatcher().
+     */
+    template<typename T>
+    struct HeapMatcher {
+
+        HeapMatcher(TypedMatcher<T> *matcher)
+                : _matcher(matcher) {
         }
 
-        template<typename Head>
-        typename std::enable_if<//
-                std::is_same<AnyMatcher, Head>::value, void> //
-        ::type CollectMatchers(const Head &) {
-            TypedMatcher<NakedArgType<index>> *d = Any<NakedArgType<index>>().createMatcher();
-            _matchers.push_back(d);
+        bool matches(const T &actual) const {
+            return _matcher->matches(actual);
         }
 
-        template<typename Head, typename ...Tail>
-        typename std::enable_if< //
-                std::is_same<AnyMatcher, Head>::value, void> //
-        ::type CollectMatchers(const Head &head, const Tail &... tail) {
-            CollectMatchers(head);
-            MatchersCollector<index + 1, arglist...> c(_matchers);
-            c.CollectMatchers(tail...);
+        std::string format() const {
+            return _matcher->format();
         }
 
+    private:
+        std::shared_ptr<TypedMatcher<T>> _matcher;
+    };
+
+    template<typename MemberPointer>
+    struct member_class_of;
+
+    template<typename R, typename C>
+    struct member_class_of<R (C::*)() const> {
+        typedef C type;
+    };
+
+    /**
+     * True if Creator itself declares createInlineMatcher(). One inherited from a creator of the library would
+     * bypass a createMatcher() that Creator overrides, so such a creator gets a HeapMatcher.
+     */
+    template<typename Creator>
+    struct has_inline_matcher {
+        template<typename C>
+        static typename std::is_same<typename member_class_of<decltype(&C::createInlineMatcher)>::type, C>::type
+        test(std::nullptr_t);
+
+        template<typename C>
+        static std::false_type test(...);
+
+        static const bool value = decltype(test<Creator>(nullptr))::value;
+    };
+
+    /**
+     * The concrete type of the matcher created for an argument of type T from a value, _ or a matcher creator.
+     * The compile time counterpart of MatchersCollector.
+     */
+    template<typename T, typename Creator, typename Enable = void>
+    struct InlineMatcherOf;
+
+    template<typename T, typename Creator>
+    struct InlineMatcherOf<T, Creator, typename std::enable_if<std::is_constructible<T, Creator>::value>::type> {
+        typedef typename internal::EqMatcherCreator<T>::Matcher type;
+
+        static type create(const Creator &value) {
+            return type(value);
+        }
+    };
+
+    template<typename T, typename Creator>
+    struct InlineMatcherOf<T, Creator, typename std::enable_if<std::is_same<AnyMatcher, Creator>::value>::type> {
+        typedef typename internal::TypedAnyMatcher<T>::Matcher type;
+
+        static type create(const Creator &) {
+            return type();
+        }
+    };
+
+    template<typename T, typename Creator>
+    struct InlineMatcherOf<T, Creator, typename std::enable_if<
+            std::is_base_of<TypedMatcherCreator<T>, Creator>::value && has_inline_matcher<Creator>::value>::type> {
+        typedef decltype(std::declval<const Creator &>().createInlineMatcher()) type;
+
+        static type create(const Creator &creator) {
+            return creator.createInlineMatcher();
+        }
+    };
+
+    template<typename T, typename Creator>
+    struct InlineMatcherOf<T, Creator, typename std::enable_if<
+            std::is_base_of<TypedMatcherCreator<T>, Creator>::value && !has_inline_matcher<Creator>::value>::type> {
+        typedef HeapMatcher<T> type;
+
+        static type create(const Creator &creator) {
+            return type(creator.createMatcher());
+        }
     };
 
 }
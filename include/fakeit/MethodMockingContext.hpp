@@ -28,6 +28,7 @@
 #include "fakeit/SpyingContext.hpp"
 #include "fakeit/StubbingContext.hpp"
 #include "fakeit/MatchersCollector.hpp"
+#include "fakeit/composite_argument_matchers.hpp"
 #include "mockutils/type_utils.hpp"
 
 namespace fakeit {
@@ -66,6 +67,8 @@ namespace fakeit {
             virtual bool isOfMethod(MethodInfo &method) = 0;
 
             virtual ActualInvocationsSource &getInvolvedMock() = 0;
+
+            virtual MethodStats &getStats() = 0;
         };
 
     private:
@@ -157,6 +160,10 @@ namespace fakeit {
                 return getStubbingContext().getOriginalMethod();
             }
 
+            MethodStats &getStats() {
+                return getStubbingContext().getStats();
+            }
+
             void setInvocationMatcher(typename ActualInvocation<arglist...>::Matcher *matcher) {
                 delete _invocationMatcher;
                 _invocationMatcher = matcher;
@@ -179,6 +186,17 @@ namespace fakeit {
 
         virtual ~MethodMockingContext() NO_THROWS { }
 
+    public:
+
+        /**
+         * Used by Mock::Stats.
+         */
+        MethodStats &getStats() const {
+            return _impl->getStats();
+        }
+
+    protected:
+
         std::string format() const override {
             return _impl->format();
         }
@@ -248,12 +266,11 @@ namespace fakeit {
         template<class ...matcherCreators, class = typename std::enable_if<
                 sizeof...(matcherCreators) == sizeof...(arglist)>::type>
         void setMatchingCriteria(const matcherCreators &... matcherCreator) {
-            std::vector<Destructible *> matchers;
-
-            MatchersCollector<0, arglist...> c(matchers);
-            c.CollectMatchers(matcherCreator...);
-
-            MethodMockingContext<R, arglist...>::setMatchingCriteria(matchers);
+            typedef std::tuple<typename InlineMatcherOf<typename naked_type<arglist>::type, matcherCreators>::type...> Matchers;
+            typename ActualInvocation<arglist...>::Matcher *matcher{
+                    new TupleArgumentsMatcherInvocationMatcher<Matchers, arglist...>(
+                            Matchers(InlineMatcherOf<typename naked_type<arglist>::type, matcherCreators>::create(matcherCreator)...))};
+            _impl->setInvocationMatcher(matcher);
         }
 
     private:
@@ -0,0 +1,213 @@
+/*
+ * MethodStats.hpp
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+
+namespace fakeit {
+
+    /**
+     * Counts of values in logarithmic buckets, each power of two split into SUB_BUCKETS linear buckets
+     * (HDR histogram style), so any recorded value is known within 1/SUB_BUCKETS of its magnitude.
+     */
+    class LatencyHistogram {
+    public:
+
+        static const unsigned int SUB_BUCKET_BITS = 2;
+        static const unsigned int SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+        static const std::size_t BUCKETS = SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+        LatencyHistogram() : _total(0) {
+            _counts.fill(0);
+        }
+
+        void record(unsigned long long value) {
+            _counts[bucketOf(value)]++;
+            _total++;
+        }
+
+        unsigned long long count() const {
+            return _total;
+        }
+
+        /**
+         * The upper bound of the bucket that holds the given percentile (0-100) of the recorded values.
+         */
+        unsigned long long percentile(double percent) const {
+            if (_total == 0)
+                return 0;
+            unsigned long long rank = (unsigned long long) (percent / 100 * _total);
+            if (rank == 0)
+                rank = 1;
+            if (rank > _total)
+                rank = _total;
+            unsigned long long seen = 0;
+            for (std::size_t i = 0; i < BUCKETS; i++) {
+                seen += _counts[i];
+                if (seen >= rank)
+                    return upperBoundOf(i);
+            }
+            return upperBoundOf(BUCKETS - 1);
+        }
+
+        static std::size_t bucketOf(unsigned long long value) {
+            if (value < SUB_BUCKETS)
+                return (std::size_t) value;
+            unsigned int msb = 0;
+            for (unsigned long long v = value; v > 1; v >>= 1)
+                msb++;
+            std::size_t sub = (std::size_t) ((value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+            return SUB_BUCKETS + (msb - SUB_BUCKET_BITS) * SUB_BUCKETS + sub;
+        }
+
+        static unsigned long long lowerBoundOf(std::size_t bucket) {
+            if (bucket < SUB_BUCKETS)
+                return bucket;
+            std::size_t msb = (bucket - SUB_BUCKETS) / SUB_BUCKETS + SUB_BUCKET_BITS;
+            unsigned long long sub = (bucket - SUB_BUCKETS) % SUB_BUCKETS;
+            return (SUB_BUCKETS + sub) << (msb - SUB_BUCKET_BITS);
+        }
+
+        static unsigned long long upperBoundOf(std::size_t bucket) {
+            if (bucket + 1 >= BUCKETS)
+                return ~0ULL;
+            return lowerBoundOf(bucket + 1) - 1;
+        }
+
+    private:
+        std::array<unsigned long long, BUCKETS> _counts;
+        unsigned long long _total;
+    };
+
+    /**
+     * Call counters of one mocked method, kept up to date on every call whether invocation history is enabled or not.
+     * Latency of the selected behavior (stub, spied original...) is only measured after setTimingEnabled(true).
+     * Calls answered directly from the virtual table (see Mock::DisableInvocationHistory) are counted, not timed.
+     */
+    class MethodStats {
+    public:
+
+        MethodStats() : _calls(0), _unmatched(0), _minNanos(0), _maxNanos(0), _totalNanos(0) {
+        }
+
+        // records the time from its creation to its destruction, if given stats.
+        class Timer {
+            MethodStats *_stats;
+            std::chrono::steady_clock::time_point _start;
+
+        public:
+            Timer(MethodStats *stats) : _stats(stats) {
+                if (_stats)
+                    _start = std::chrono::steady_clock::now();
+            }
+
+            ~Timer() {
+                if (_stats) {
+                    auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - _start).count();
+                    _stats->recordLatency((unsigned long long) nanos);
+                }
+            }
+        };
+
+        unsigned long long calls() const {
+            return _calls;
+        }
+
+        unsigned long long matched() const {
+            return _calls - _unmatched;
+        }
+
+        unsigned long long unmatched() const {
+            return _unmatched;
+        }
+
+        // the timing of the calls made before timing was last enabled is dropped.
+        void setTimingEnabled(bool enabled) {
+            if (enabled != isTimingEnabled())
+                resetTiming(enabled);
+        }
+
+        bool isTimingEnabled() const {
+            return _histogram != nullptr;
+        }
+
+        unsigned long long timedCalls() const {
+            return _histogram ? _histogram->count() : 0;
+        }
+
+        unsigned long long minNanos() const {
+            return _minNanos;
+        }
+
+        unsigned long long maxNanos() const {
+            return _maxNanos;
+        }
+
+        double meanNanos() const {
+            return timedCalls() ? (double) _totalNanos / timedCalls() : 0;
+        }
+
+        // upper bound of the given percentile (0-100) of the timed calls, 0 if timing is disabled.
+        unsigned long long percentileNanos(double percent) const {
+            return _histogram ? _histogram->percentile(percent) : 0;
+        }
+
+        void reset() {
+            _calls = 0;
+            _unmatched = 0;
+            resetTiming(isTimingEnabled());
+        }
+
+        void countCall() {
+            _calls++;
+        }
+
+        void countUnmatched() {
+            _unmatched++;
+        }
+
+        // incremented by the constant method proxy, for calls that never reach the method body.
+        unsigned long long *callCounter() {
+            return &_calls;
+        }
+
+    private:
+
+        // the accumulators always describe the calls in the histogram.
+        void resetTiming(bool enabled) {
+            _histogram.reset(enabled ? new LatencyHistogram() : nullptr);
+            _minNanos = 0;
+            _maxNanos = 0;
+            _totalNanos = 0;
+        }
+
+        void recordLatency(unsigned long long nanos) {
+            if (!_histogram)
+                return;
+            if (_histogram->count() == 0 || nanos < _minNanos)
+                _minNanos = nanos;
+            if (nanos > _maxNanos)
+                _maxNanos = nanos;
+            _totalNanos += nanos;
+            _histogram->record(nanos);
+        }
+
+        unsigned long long _calls;
+        unsigned long long _unmatched;
+        unsigned long long _minNanos;
+        unsigned long long _maxNanos;
+        unsigned long long _totalNanos;
+        std::unique_ptr<LatencyHistogram> _histogram;
+    };
+
+}
@@ -8,7 +8,9 @@
 #pragma once
 
 #include <type_traits>
+#include <typeinfo>
 #include <unordered_set>
+#include <vector>
 
 #include <memory>
 
@@ -24,7 +26,7 @@ namespace fakeit {
 
     
     template<typename C, typename ... baseclasses>
-    class MockImpl : private MockObject<C>, public virtual ActualInvocationsSource {
+    class MockImpl : private MockObject<C>, private InvocationShortcuts, public virtual ActualInvocationsSource {
     public:
 
         MockImpl(FakeitContext &fakeit, C &obj)
@@ -32,12 +34,11 @@ namespace fakeit {
         }
 
         MockImpl(FakeitContext &fakeit)
-                : MockImpl<C, baseclasses...>(fakeit, *(createFakeInstance()), false) {
-            FakeObject<C, baseclasses...> *fake = reinterpret_cast<FakeObject<C, baseclasses...> *>(_instance);
-            fake->getVirtualTable().setCookie(1, this);
+                : MockImpl<C, baseclasses...>(fakeit, *(createFakeInstance(fakeit)), false) {
         }
 
         virtual ~MockImpl() NO_THROWS {
+            _fakeit.removeInvocationShortcuts(*this);
             _proxy.detach();
             if (_isOwner) {
                 FakeObject<C, baseclasses...> *fake = reinterpret_cast<FakeObject<C, baseclasses...> *>(_instance);
@@ -84,6 +85,21 @@ namespace fakeit {
 			initDataMembersIfOwner();
         }
 
+        void setInvocationHistoryEnabled(bool enabled) {
+            // only a mock without history may answer with constants, only then it is refreshed by the context.
+            if (enabled && !_isInvocationHistoryEnabled)
+                _fakeit.removeInvocationShortcuts(*this);
+            else if (!enabled && _isInvocationHistoryEnabled)
+                _fakeit.addInvocationShortcuts(*this);
+            _isInvocationHistoryEnabled = enabled;
+            std::vector<ActualInvocationsContainer *> vec;
+            _proxy.getMethodMocks(vec);
+            for (ActualInvocationsContainer *s : vec) {
+                s->setInvocationHistoryEnabled(enabled);
+            }
+            _proxy.refreshConstantMethodProxies();
+        }
+
         virtual C &get() override {
             return _proxy.get();
         }
@@ -98,10 +114,10 @@ namespace fakeit {
             return DataMemberStubbingRoot<T, DATA_TYPE>();
         }
 
-        template<int id, typename R, typename T, typename ... arglist, class = typename std::enable_if<std::is_base_of<T, C>::value>::type>
+        template<typename Key, typename R, typename T, typename ... arglist, class = typename std::enable_if<std::is_base_of<T, C>::value>::type>
         MockingContext<R, arglist...> stubMethod(R(T::*vMethod)(arglist...)) {
-            return MockingContext<R, arglist...>(new UniqueMethodMockingContextImpl < id, R, arglist... >
-                   (*this, vMethod));
+            MethodProxy methodProxy = MethodProxyCreator<R, arglist...>::template createMethodProxy<Key>(VTUtils::getOffset(vMethod));
+            return MockingContext<R, arglist...>(new MethodMockingContextImpl<R, arglist...>(*this, vMethod, methodProxy));
         }
 
         DtorMockingContext stubDtor() {
@@ -109,10 +125,14 @@ namespace fakeit {
         }
 
     private:
+        // cookie of the fake's virtual table that holds the FakeitContext.
+        static const int FAKEIT_CONTEXT_COOKIE_INDEX = 1;
+
         DynamicProxy<C, baseclasses...> _proxy;
         C *_instance; //
         bool _isOwner;
         FakeitContext &_fakeit;
+        bool _isInvocationHistoryEnabled;
 
         template<typename R, typename ... arglist>
         class MethodMockingContextBase : public MethodMockingContext<R, arglist...>::Context {
@@ -121,6 +141,9 @@ namespace fakeit {
 
             virtual RecordedMethodBody<R, arglist...> &getRecordedMethodBody() = 0;
 
+            // after a handler is added, the method may start or stop returning a constant.
+            virtual void refreshConstantMethodProxy() = 0;
+
         public:
             MethodMockingContextBase(MockImpl<C, baseclasses...> &mock) : _mock(mock) { }
 
@@ -129,6 +152,7 @@ namespace fakeit {
             void addMethodInvocationHandler(typename ActualInvocation<arglist...>::Matcher *matcher,
                 ActualInvocationHandler<R, arglist...> *invocationHandler) {
                 getRecordedMethodBody().addMethodInvocationHandler(matcher, invocationHandler);
+                refreshConstantMethodProxy();
             }
 
             void scanActualInvocations(const std::function<void(ActualInvocation<arglist...> &)> &scanner) {
@@ -151,6 +175,10 @@ namespace fakeit {
                 return getRecordedMethodBody().getMethod().name();
             }
 
+            MethodStats &getStats() {
+                return getRecordedMethodBody().getStats();
+            }
+
         };
 
         template<typename R, typename ... arglist>
@@ -158,17 +186,27 @@ namespace fakeit {
         protected:
 
             R (C::*_vMethod)(arglist...);
-            
+            MethodProxy _methodProxy; // of _vMethod, created once per Method(...) expression.
+
+            virtual RecordedMethodBody<R, arglist...> &getRecordedMethodBody() override {
+                return MethodMockingContextBase<R, arglist...>::_mock.stubMethodIfNotStubbed(
+                        MethodMockingContextBase<R, arglist...>::_mock._proxy, _vMethod, _methodProxy);
+            }
+
+            virtual void refreshConstantMethodProxy() override {
+                MethodMockingContextBase<R, arglist...>::_mock._proxy.refreshConstantMethodProxy(_methodProxy.getOffset());
+            }
+
         public:
             virtual ~MethodMockingContextImpl() = default;
 
-            MethodMockingContextImpl(MockImpl<C, baseclasses...> &mock, R (C::*vMethod)(arglist...))
-                    : MethodMockingContextBase<R, arglist...>(mock), _vMethod(vMethod) {
+            MethodMockingContextImpl(MockImpl<C, baseclasses...> &mock, R (C::*vMethod)(arglist...), const MethodProxy &methodProxy)
+                    : MethodMockingContextBase<R, arglist...>(mock), _vMethod(vMethod), _methodProxy(methodProxy) {
             }
 
             
             virtual std::function<R(arglist&...)> getOriginalMethod() override {
-                void *mPtr = MethodMockingContextBase<R, arglist...>::_mock.getOriginalMethod(_vMethod);
+                void *mPtr = MethodMockingContextBase<R, arglist...>::_mock.getOriginalMethod(_methodProxy.getOffset());
                 C * instance = &(MethodMockingContextBase<R, arglist...>::_mock.get());
                 return [=](arglist&... args) -> R {
                     auto m = union_cast<typename VTableMethodType<R,arglist...>::type>(mPtr);
@@ -178,23 +216,6 @@ namespace fakeit {
         };
 
 
-        template<int id, typename R, typename ... arglist>
-        class UniqueMethodMockingContextImpl : public MethodMockingContextImpl<R, arglist...> {
-        protected:
-
-            virtual RecordedMethodBody<R, arglist...> &getRecordedMethodBody() override {
-                return MethodMockingContextBase<R, arglist...>::_mock.template stubMethodIfNotStubbed<id>(
-                        MethodMockingContextBase<R, arglist...>::_mock._proxy,
-                        MethodMockingContextImpl<R, arglist...>::_vMethod);
-            }
-
-        public:
-
-            UniqueMethodMockingContextImpl(MockImpl<C, baseclasses...> &mock, R (C::*vMethod)(arglist...))
-                    : MethodMockingContextImpl<R, arglist...>(mock, vMethod) {
-            }
-        };
-
         class DtorMockingContextImpl : public MethodMockingContextBase<void> {
 
         protected:
@@ -204,6 +225,10 @@ namespace fakeit {
                         MethodMockingContextBase<void>::_mock._proxy);
             }
 
+            // the destructor is never answered with a constant.
+            virtual void refreshConstantMethodProxy() override {
+            }
+
         public:
             virtual ~DtorMockingContextImpl() = default;
 
@@ -219,35 +244,55 @@ namespace fakeit {
 
         };
 
-        static MockImpl<C, baseclasses...> *getMockImpl(void *instance) {
+        static FakeitContext &getFakeitContext(void *instance) {
             FakeObject<C, baseclasses...> *fake = reinterpret_cast<FakeObject<C, baseclasses...> *>(instance);
-            MockImpl<C, baseclasses...> *mock = reinterpret_cast<MockImpl<C, baseclasses...> *>(fake->getVirtualTable().getCookie(
-                    1));
-            return mock;
+            FakeitContext *fakeit = reinterpret_cast<FakeitContext *>(fake->getVirtualTable().getCookie(
+                    FAKEIT_CONTEXT_COOKIE_INDEX));
+            return *fakeit;
         }
 
         void unmocked() {
             ActualInvocation<> invocation(Invocation::nextInvocationOrdinal(), UnknownMethod::instance());
             UnexpectedMethodCallEvent event(UnexpectedType::Unmocked, invocation);
-            auto &fakeit = getMockImpl(this)->_fakeit;
+            auto &fakeit = getFakeitContext(this);
             fakeit.handle(event);
 
-            std::string format = fakeit.format(event);
-            UnexpectedMethodCallException e(format);
+            UnexpectedMethodCallException e(fakeit.asEventFormatter(), event);
             throw e;
         }
 
-        static C *createFakeInstance() {
-            FakeObject<C, baseclasses...> *fake = new FakeObject<C, baseclasses...>();
-            void *unmockedMethodStubPtr = union_cast<void *>(&MockImpl<C, baseclasses...>::unmocked);
-            fake->getVirtualTable().initAll(unmockedMethodStubPtr);
+        // the virtual table where every method is unmocked, shared by the fakes of C of one context.
+        struct PrototypeVirtualTable : public Destructible {
+            VirtualTable<C, baseclasses...> table;
+
+            virtual ~PrototypeVirtualTable() {
+                table.dispose();
+            }
+        };
+
+        /**
+         * The prototype is kept by the context and disposed with it.
+         */
+        static VirtualTable<C, baseclasses...> &getPrototypeVirtualTable(FakeitContext &fakeit) {
+            const void *key = &typeid(PrototypeVirtualTable);
+            PrototypeVirtualTable *prototype = static_cast<PrototypeVirtualTable *>(fakeit.getSharedObject(key));
+            if (!prototype) {
+                prototype = new PrototypeVirtualTable();
+                void *unmockedMethodStubPtr = union_cast<void *>(&MockImpl<C, baseclasses...>::unmocked);
+                prototype->table.initAll(unmockedMethodStubPtr);
+                prototype->table.setCookie(FAKEIT_CONTEXT_COOKIE_INDEX, &fakeit);
+                fakeit.addSharedObject(key, prototype);
+            }
+            return prototype->table;
+        }
+
+        static C *createFakeInstance(FakeitContext &fakeit) {
+            FakeObject<C, baseclasses...> *fake = new FakeObject<C, baseclasses...>(getPrototypeVirtualTable(fakeit));
             return reinterpret_cast<C *>(fake);
         }
 
-        template<typename R, typename ... arglist>
-        void *getOriginalMethod(R (C::*vMethod)(arglist...)) {
+        void *getOriginalMethod(unsigned int offset) {
             auto vt = _proxy.getOriginalVT();
-            auto offset = VTUtils::getOffset(vMethod);
             void *origMethodPtr = vt.getMethod(offset);
             return origMethodPtr;
         }
@@ -259,20 +304,25 @@ namespace fakeit {
             return origMethodPtr;
         }
 
-        template<unsigned int id, typename R, typename ... arglist>
+        template<typename R, typename ... arglist>
         RecordedMethodBody<R, arglist...> &stubMethodIfNotStubbed(DynamicProxy<C, baseclasses...> &proxy,
-                                                                  R (C::*vMethod)(arglist...)) {
-            if (!proxy.isMethodStubbed(vMethod)) {
-                proxy.template stubMethod<id>(vMethod, createRecordedMethodBody < R, arglist... > (*this, vMethod));
+                                                                  R (C::*vMethod)(arglist...), const MethodProxy &methodProxy) {
+            Destructible *d = proxy.getMethodMock(methodProxy.getOffset());
+            if (!d) {
+                RecordedMethodBody<R, arglist...> *body = createRecordedMethodBody < R, arglist... > (*this, vMethod);
+                body->setInvocationHistoryEnabled(_isInvocationHistoryEnabled);
+                proxy.stubMethod(methodProxy, body);
+                d = proxy.getMethodMock(methodProxy.getOffset());
             }
-            Destructible *d = proxy.getMethodMock(vMethod);
             RecordedMethodBody<R, arglist...> *methodMock = dynamic_cast<RecordedMethodBody<R, arglist...> *>(d);
             return *methodMock;
         }
 
         RecordedMethodBody<void> &stubDtorIfNotStubbed(DynamicProxy<C, baseclasses...> &proxy) {
             if (!proxy.isDtorStubbed()) {
-                proxy.stubDtor(createRecordedDtorBody(*this));
+                RecordedMethodBody<void> *body = createRecordedDtorBody(*this);
+                body->setInvocationHistoryEnabled(_isInvocationHistoryEnabled);
+                proxy.stubDtor(body);
             }
             Destructible *d = proxy.getDtorMock();
             RecordedMethodBody<void> *dtorMock = dynamic_cast<RecordedMethodBody<void> *>(d);
@@ -280,7 +330,12 @@ namespace fakeit {
         }
 
         MockImpl(FakeitContext &fakeit, C &obj, bool isSpy)
-                : _proxy{obj}, _instance(&obj), _isOwner(!isSpy), _fakeit(fakeit) {
+                : _proxy{obj, !isSpy}, _instance(&obj), _isOwner(!isSpy), _fakeit(fakeit), _isInvocationHistoryEnabled(true) {
+        }
+
+        // the constant method proxies are not used while invocation event handlers observe the calls.
+        void refreshInvocationShortcuts() override {
+            _proxy.refreshConstantMethodProxies();
         }
 
         template<typename R, typename ... arglist>
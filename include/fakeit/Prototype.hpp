@@ -28,22 +28,13 @@ namespace fakeit {
 
         };
 
-    };
-
-    template<int X, typename R, typename C, typename... arglist>
-    struct UniqueMethod {
-        R (C::*method)(arglist...);
+        // Used in decltype only. Selects the overload that matches the prototype, and the class that declares it.
+        template<class C>
+        static typename MemberType<C>::type memberOf(Type C::*);
 
-        UniqueMethod(R (C::*vMethod)(arglist...)) : method(vMethod) { }
+        template<class C>
+        static typename MemberType<C>::cosntType constMemberOf(ConstType C::*);
 
-        int uniqueId() {
-            return X;
-        }
-//        typedef typename std::remove_cv<R>::type naked_return_type;
-//        typedef naked_return_type method_type(Args...);
-//        //typedef naked_return_type(C::*member_type)(Args...);
-//        typedef method_type(C::*member_type);
     };
 
 }
-
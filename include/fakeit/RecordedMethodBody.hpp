@@ -9,15 +9,22 @@
 
 #include <vector>
 #include <functional>
+#include <memory>
+#include <string>
+#include <typeinfo>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 #include "mockutils/TupleDispatcher.hpp"
 #include "fakeit/DomainObjects.hpp"
 #include "fakeit/ActualInvocation.hpp"
 #include "fakeit/ActualInvocationHandler.hpp"
+#include "fakeit/ActionSequence.hpp"
 #include "fakeit/invocation_matchers.hpp"
 #include "fakeit/FakeitEvents.hpp"
 #include "fakeit/FakeitExceptions.hpp"
+#include "fakeit/MethodStats.hpp"
 #include "mockutils/MethodInvocationHandler.hpp"
 
 namespace fakeit {
@@ -26,7 +33,8 @@ namespace fakeit {
  * A composite MethodInvocationHandler that holds a list of ActionSequence objects.
  */
     template<typename R, typename ... arglist>
-    class RecordedMethodBody : public MethodInvocationHandler<R, arglist...>, public ActualInvocationsSource, public ActualInvocationsContainer {
+    class RecordedMethodBody : public MethodInvocationHandler<R, arglist...>, public ActualInvocationsSource, public ActualInvocationsContainer,
+                               public ConstantReturnValueSource {
 
         struct MatchedInvocationHandler : ActualInvocationHandler<R, arglist...> {
 
@@ -44,6 +52,16 @@ namespace fakeit {
                 return invocationHandler.handleMethodInvocation(args);
             }
 
+            /**
+             * Address of the value returned for any arguments, or nullptr.
+             */
+            const void *getConstantReturnValue() const {
+                if (!dynamic_cast<DefaultInvocationMatcher<arglist...> *>(_matcher.get()))
+                    return nullptr;
+                auto actionSequence = dynamic_cast<ActionSequence<R, arglist...> *>(_invocationHandler.get());
+                return actionSequence ? actionSequence->getConstantValue() : nullptr;
+            }
+
             typename ActualInvocation<arglist...>::Matcher &getMatcher() const {
                 Destructible &destructable = *_matcher;
                 typename ActualInvocation<arglist...>::Matcher &matcher = dynamic_cast<typename ActualInvocation<arglist...>::Matcher &>(destructable);
@@ -61,6 +79,8 @@ namespace fakeit {
 
         std::vector<std::shared_ptr<Destructible>> _invocationHandlers;
         std::vector<std::shared_ptr<Destructible>> _actualInvocations;
+        MethodStats _stats;
+        bool _isInvocationHistoryEnabled;
 
         MatchedInvocationHandler *buildMatchedInvocationHandler(
                 typename ActualInvocation<arglist...>::Matcher *invocationMatcher,
@@ -90,10 +110,163 @@ namespace fakeit {
             return invocation;
         }
 
+        // the arguments of an ActualInvocation, for the InvocationEvent.
+        struct ArgumentsView : public InvocationArguments {
+
+            ArgumentsView(ArgumentsTuple<arglist...> &arguments)
+                    : _arguments(arguments) {
+                collectAddresses(make_index_sequence<sizeof...(arglist)>());
+            }
+
+            virtual std::size_t size() const override {
+                return sizeof...(arglist);
+            }
+
+            virtual const std::type_info &type(std::size_t index) const override {
+                // the leading void keeps the array non empty.
+                static const std::type_info *types[] = {&typeid(void), &typeid(typename naked_type<arglist>::type)...};
+                return *types[index + 1];
+            }
+
+            virtual const void *address(std::size_t index) const override {
+                return _addresses[index + 1];
+            }
+
+            virtual void formatTo(std::string &out) const override {
+                formatTuple(out, _arguments);
+            }
+
+        private:
+
+            template<std::size_t ... I>
+            void collectAddresses(index_sequence<I...>) {
+                const void *addresses[] = {nullptr, static_cast<const void *>(std::addressof(std::get<I>(_arguments)))...};
+                for (std::size_t i = 0; i < sizeof...(arglist) + 1; i++)
+                    _addresses[i] = addresses[i];
+            }
+
+            const ArgumentsTuple<arglist...> &_arguments;
+            const void *_addresses[sizeof...(arglist) + 1];
+        };
+
+        // notifies the start of a call, and its completion. A call that throws (or whose start() threw) is
+        // completed when the notification is destroyed, and exceptions of the completion handlers are ignored.
+        struct InvocationNotification {
+
+            InvocationNotification(FakeitContext &fakeit, ActualInvocation<arglist...> &actualInvocation)
+                    : _fakeit(fakeit), _arguments(actualInvocation.getActualArguments()),
+                      _event(actualInvocation, _arguments), _isCompleted(false) {
+            }
+
+            ~InvocationNotification() {
+                if (_isCompleted)
+                    return;
+                try {
+                    _fakeit.notifyInvocationCompletion(_event);
+                } catch (...) {
+                }
+            }
+
+            void start() {
+                _fakeit.notifyInvocation(_event);
+            }
+
+            void complete() {
+                _isCompleted = true;
+                _fakeit.notifyInvocationCompletion(_event);
+            }
+
+        private:
+            FakeitContext &_fakeit;
+            ArgumentsView _arguments;
+            InvocationEvent _event;
+            bool _isCompleted;
+        };
+
+        R callHandler(MatchedInvocationHandler &invocationHandler, typename ActualInvocation<arglist...>::Matcher &matcher,
+                      ArgumentsTuple<arglist...> &args, bool canMove) {
+            try {
+                return invocationHandler.handleMethodInvocation(args);
+            } catch (NoMoreRecordedActionException &) {
+                throw;
+            } catch (...) {
+                matcher.dispatched(args, canMove);
+                throw;
+            }
+        }
+
+        // the matcher is notified after the behavior ran, so it may move the arguments out.
+        template<typename T = R>
+        typename std::enable_if<!std::is_void<T>::value, T>::type
+        dispatch(MatchedInvocationHandler &invocationHandler, typename ActualInvocation<arglist...>::Matcher &matcher,
+                 ArgumentsTuple<arglist...> &args, bool canMove) {
+            T result = callHandler(invocationHandler, matcher, args, canMove);
+            matcher.dispatched(args, canMove);
+            return std::forward<T>(result);
+        }
+
+        template<typename T = R>
+        typename std::enable_if<std::is_void<T>::value, T>::type
+        dispatch(MatchedInvocationHandler &invocationHandler, typename ActualInvocation<arglist...>::Matcher &matcher,
+                 ArgumentsTuple<arglist...> &args, bool canMove) {
+            callHandler(invocationHandler, matcher, args, canMove);
+            matcher.dispatched(args, canMove);
+        }
+
+        R handleActualInvocation(ActualInvocation<arglist...> &actualInvocation, std::shared_ptr<Destructible> *record) {
+            if (_fakeit.hasInvocationEventHandlers()) {
+                return notifyAndDispatch(actualInvocation, record);
+            }
+            return dispatchActualInvocation(actualInvocation, record);
+        }
+
+        template<typename T = R>
+        typename std::enable_if<!std::is_void<T>::value, T>::type
+        notifyAndDispatch(ActualInvocation<arglist...> &actualInvocation, std::shared_ptr<Destructible> *record) {
+            InvocationNotification notification(_fakeit, actualInvocation);
+            notification.start();
+            T result = dispatchActualInvocation(actualInvocation, record);
+            notification.complete();
+            return std::forward<T>(result);
+        }
+
+        template<typename T = R>
+        typename std::enable_if<std::is_void<T>::value, T>::type
+        notifyAndDispatch(ActualInvocation<arglist...> &actualInvocation, std::shared_ptr<Destructible> *record) {
+            InvocationNotification notification(_fakeit, actualInvocation);
+            notification.start();
+            dispatchActualInvocation(actualInvocation, record);
+            notification.complete();
+        }
+
+        R dispatchActualInvocation(ActualInvocation<arglist...> &actualInvocation, std::shared_ptr<Destructible> *record) {
+            _stats.countCall();
+            auto invocationHandler = getInvocationHandlerForActualArgs(actualInvocation);
+            if (invocationHandler) {
+                auto &matcher = invocationHandler->getMatcher();
+                actualInvocation.setActualMatcher(&matcher);
+                if (record)
+                    _actualInvocations.push_back(*record);
+                try {
+                    MethodStats::Timer timer(_stats.isTimingEnabled() ? &_stats : nullptr);
+                    // the arguments can be moved out only if the invocation is not recorded.
+                    return dispatch(*invocationHandler, matcher, actualInvocation.getActualArguments(), record == nullptr);
+                } catch (NoMoreRecordedActionException &) {
+                }
+            }
+
+            _stats.countUnmatched();
+
+            UnexpectedMethodCallEvent event(UnexpectedType::Unmatched, actualInvocation);
+            _fakeit.handle(event);
+            UnexpectedMethodCallException e(_fakeit.asEventFormatter(), event);
+            throw e;
+        }
+
     public:
 
         RecordedMethodBody(FakeitContext &fakeit, std::string name) :
-                _fakeit(fakeit), _method{MethodInfo::nextMethodOrdinal(), name} { }
+                _fakeit(fakeit), _method{MethodInfo::nextMethodOrdinal(), name}, _isInvocationHistoryEnabled(true) { }
 
         virtual ~RecordedMethodBody() NO_THROWS {
         }
@@ -117,36 +290,52 @@ namespace fakeit {
         void reset() { // this method is never used!! Delete !!!
             _invocationHandlers.clear();
             _actualInvocations.clear();
+            _stats.reset();
         }
 
 		void clear() override { // this method is never used!! Delete !!!
 			_actualInvocations.clear();
+			_stats.reset();
 		}
 
+        MethodStats &getStats() {
+            return _stats;
+        }
+
+        void setInvocationHistoryEnabled(bool enabled) override {
+            _isInvocationHistoryEnabled = enabled;
+        }
+
+        /**
+         * Only the last handler added matters when it matches any arguments.
+         * Nothing is constant while invocations are recorded or observed by invocation event handlers.
+         */
+        const void *getConstantReturnValue() override {
+            if (_isInvocationHistoryEnabled || _fakeit.hasInvocationEventHandlers() || _invocationHandlers.empty())
+                return nullptr;
+            MatchedInvocationHandler &im = asMatchedInvocationHandler(*_invocationHandlers.back());
+            return im.getConstantReturnValue();
+        }
+
+        unsigned long long *getConstantReturnCalls() override {
+            return _stats.callCounter();
+        }
+
         R handleMethodInvocation(const typename fakeit::production_arg<arglist>::type... args) override {
             unsigned int ordinal = Invocation::nextInvocationOrdinal();
             MethodInfo &method = this->getMethod();
+
+            if (!_isInvocationHistoryEnabled) {
+                // Nothing is recorded, so the invocation can live on the stack.
+                ActualInvocation<arglist...> actualInvocation(ordinal, method, std::forward<const typename fakeit::production_arg<arglist>::type>(args)...);
+                return handleActualInvocation(actualInvocation, nullptr);
+            }
+
             auto actualInvocation = new ActualInvocation<arglist...>(ordinal, method, std::forward<const typename fakeit::production_arg<arglist>::type>(args)...);
 
             // ensure deletion if not added to actual invocations.
             std::shared_ptr<Destructible> actualInvocationDtor{actualInvocation};
-
-            auto invocationHandler = getInvocationHandlerForActualArgs(*actualInvocation);
-            if (invocationHandler) {
-                auto &matcher = invocationHandler->getMatcher();
-                actualInvocation->setActualMatcher(&matcher);
-                _actualInvocations.push_back(actualInvocationDtor);
-                try {
-                    return invocationHandler->handleMethodInvocation(actualInvocation->getActualArguments());
-                } catch (NoMoreRecordedActionException &) {
-                }
-            }
-
-            UnexpectedMethodCallEvent event(UnexpectedType::Unmatched, *actualInvocation);
-            _fakeit.handle(event);
-            std::string format{_fakeit.format(event)};
-            UnexpectedMethodCallException e(format);
-            throw e;
+            return handleActualInvocation(*actualInvocation, &actualInvocationDtor);
         }
 
         void scanActualInvocations(const std::function<void(ActualInvocation<arglist...> &)> &scanner) {
@@ -24,7 +24,21 @@ namespace fakeit {
         }
 
         void setExpectedCount(const int count) {
-            _expectedCount = count;
+            // negative number represents an "AtLeast" search;
+            if (count < 0) {
+                setExpectedRange(VerificationType::AtLeast, -count, -1);
+            } else {
+                setExpectedRange(VerificationType::Exact, count, count);
+            }
+        }
+
+        /**
+         * A negative maxCount leaves the range open ended.
+         */
+        void setExpectedRange(VerificationType verificationType, const int minCount, const int maxCount) {
+            _verificationType = verificationType;
+            _expectedCount = minCount;
+            _expectedMaxCount = maxCount;
         }
 
         void setFileInfo(const char * file, int line, const char * callingMethod) {
@@ -38,7 +52,9 @@ namespace fakeit {
         VerificationEventHandler &_fakeit;
         InvocationsSourceProxy _involvedInvocationSources;
         std::vector<Sequence *> _expectedPattern;
+        VerificationType _verificationType;
         int _expectedCount;
+        int _expectedMaxCount;
 
         const char * _file;
         int _line;
@@ -52,7 +68,9 @@ namespace fakeit {
                 _fakeit(fakeit),
                 _involvedInvocationSources(mocks),
                 _expectedPattern(expectedPattern), //
-                _expectedCount(-1), // AT_LEAST_ONCE
+                _verificationType(VerificationType::AtLeast), // AT_LEAST_ONCE
+                _expectedCount(1),
+                _expectedMaxCount(-1),
                 _line(0),
                 _isVerified(false) {
         }
@@ -64,14 +82,10 @@ namespace fakeit {
             _isVerified = true;
 
             MatchAnalysis ma;
-            ma.run(_involvedInvocationSources, _expectedPattern);
+            ma.run(_involvedInvocationSources, _expectedPattern, isCountingStoppedOverLimit() ? _expectedMaxCount : -1);
 
-            if (isAtLeastVerification() && atLeastLimitNotReached(ma.count)) {
-                return handleAtLeastVerificationEvent(verificationErrorHandler, ma.actualSequence, ma.count);
-            }
-
-            if (isExactVerification() && exactLimitNotMatched(ma.count)) {
-                return handleExactVerificationEvent(verificationErrorHandler, ma.actualSequence, ma.count);
+            if (ma.count < _expectedCount || (_expectedMaxCount >= 0 && ma.count > _expectedMaxCount)) {
+                return handleVerificationEvent(verificationErrorHandler, ma);
             }
 
             markAsVerified(ma.matchedInvocations);
@@ -95,35 +109,22 @@ namespace fakeit {
             }
         }
 
-        bool isAtLeastVerification() {
-            // negative number represents an "AtLeast" search;
-            return _expectedCount < 0;
-        }
-
-        bool isExactVerification() {
-            return !isAtLeastVerification();
+        // AtMost and Between fail as soon as the limit is passed, there is no need to count any further.
+        // Exact keeps counting so a failure reports the actual number of matches.
+        bool isCountingStoppedOverLimit() {
+            return _verificationType == VerificationType::AtMost || _verificationType == VerificationType::Between;
         }
 
-        bool atLeastLimitNotReached(int count) {
-            return count < -_expectedCount;
-        }
-
-        bool exactLimitNotMatched(int count) {
-            return count != _expectedCount;
-        }
-
-        void handleExactVerificationEvent(VerificationEventHandler &verificationErrorHandler,
-                                          std::vector<Invocation *> actualSequence, int count) {
-            SequenceVerificationEvent evt(VerificationType::Exact, _expectedPattern, actualSequence, _expectedCount,
-                                          count);
-            evt.setFileInfo(_file, _line, _testMethod);
-            return verificationErrorHandler.handle(evt);
-        }
-
-        void handleAtLeastVerificationEvent(VerificationEventHandler &verificationErrorHandler,
-                                            std::vector<Invocation *> actualSequence, int count) {
-            SequenceVerificationEvent evt(VerificationType::AtLeast, _expectedPattern, actualSequence, -_expectedCount,
-                                          count);
+        void handleVerificationEvent(VerificationEventHandler &verificationErrorHandler, const MatchAnalysis &ma) {
+            int closestMatchStart = ma.closestMatchStart;
+            int closestMatchLength = ma.closestMatchLength;
+            if (isCountingStoppedOverLimit() && ma.count > _expectedMaxCount) {
+                // point at the match that went over the limit.
+                closestMatchStart = ma.lastMatchStart;
+                closestMatchLength = (int) _expectedPattern[0]->size();
+            }
+            SequenceVerificationEvent evt(_verificationType, _expectedPattern, ma.actualSequence, _expectedCount,
+                                          ma.count, closestMatchStart, closestMatchLength, _expectedMaxCount);
             evt.setFileInfo(_file, _line, _testMethod);
             return verificationErrorHandler.handle(evt);
         }
@@ -116,6 +116,33 @@ namespace fakeit {
             return Terminator(_expectationPtr);
         }
 
+        Terminator AtMost(const int times) {
+            if (times < 0) {
+                throw std::invalid_argument(std::string("bad argument times:").append(fakeit::to_string(times)));
+            }
+            _expectationPtr->setExpectedRange(VerificationType::AtMost, 0, times);
+            return Terminator(_expectationPtr);
+        }
+
+        Terminator AtMost(const Quantity &q) {
+            AtMost(q.quantity);
+            return Terminator(_expectationPtr);
+        }
+
+        Terminator Between(const int minTimes, const int maxTimes) {
+            if (minTimes < 0 || maxTimes < minTimes) {
+                throw std::invalid_argument(std::string("bad argument times:").append(fakeit::to_string(minTimes))
+                                                    .append("..").append(fakeit::to_string(maxTimes)));
+            }
+            _expectationPtr->setExpectedRange(VerificationType::Between, minTimes, maxTimes);
+            return Terminator(_expectationPtr);
+        }
+
+        Terminator Between(const Quantity &minQ, const Quantity &maxQ) {
+            Between(minQ.quantity, maxQ.quantity);
+            return Terminator(_expectationPtr);
+        }
+
         SequenceVerificationProgress setFileInfo(const char * file, int line, const char * callingMethod) {
             _expectationPtr->setFileInfo(file, line, callingMethod);
             return *this;
@@ -59,7 +59,7 @@ namespace fakeit {
         template<typename U = R>
         typename std::enable_if<!std::is_reference<U>::value, void>::type
         AlwaysReturn(const R &r) {
-            return AlwaysDo([r](const typename fakeit::test_arg<arglist>::type...) -> R { return r; });
+            DoImpl(new ReturnConstantValue<R, arglist...>(r));
         }
 
         template<typename U = R>
@@ -74,7 +74,7 @@ namespace fakeit {
         }
 
         void AlwaysReturn() {
-            return AlwaysDo([](const typename fakeit::test_arg<arglist>::type...) -> R { return DefaultValue<R>::value(); });
+            DoImpl(new ReturnDefaultValue<R, arglist...>());
         }
 
         template<typename E>
@@ -153,7 +153,7 @@ namespace fakeit {
 
 
         void AlwaysReturn() {
-            return AlwaysDo([](const typename fakeit::test_arg<arglist>::type...) -> void { return DefaultValue<void>::value(); });
+            DoImpl(new ReturnDefaultValue<void, arglist...>());
         }
 
         MethodStubbingProgress<void, arglist...> &
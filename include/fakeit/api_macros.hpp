@@ -13,26 +13,44 @@
 #define CONST_OVERLOADED_METHOD_PTR(mock, method, prototype) \
     fakeit::Prototype<prototype>::MemberType<MOCK_TYPE(mock)>::getconst(&MOCK_TYPE(mock)::method)
 
+// Method(...) expressions of the same method share one key, so they share their template instantiations.
+#define METHOD_KEY(mock, method) \
+    fakeit::MethodKey<decltype(&MOCK_TYPE(mock)::method), &MOCK_TYPE(mock)::method>
+
+#define OVERLOADED_METHOD_KEY(mock, method, prototype) \
+    fakeit::MethodKey<decltype(fakeit::Prototype<prototype>::memberOf(&MOCK_TYPE(mock)::method)), &MOCK_TYPE(mock)::method>
+
+#define CONST_OVERLOADED_METHOD_KEY(mock, method, prototype) \
+    fakeit::MethodKey<decltype(fakeit::Prototype<prototype>::constMemberOf(&MOCK_TYPE(mock)::method)), &MOCK_TYPE(mock)::method>
+
 #define Dtor(mock) \
     mock.dtor().setMethodDetails(#mock,"destructor")
 
 #define Method(mock, method) \
-    mock.template stub<__COUNTER__>(&MOCK_TYPE(mock)::method).setMethodDetails(#mock,#method)
+    mock.template stub<METHOD_KEY(mock, method)>(&MOCK_TYPE(mock)::method).setMethodDetails(#mock,#method)
 
 #define OverloadedMethod(mock, method, prototype) \
-    mock.template stub<__COUNTER__>(OVERLOADED_METHOD_PTR( mock , method, prototype )).setMethodDetails(#mock,#method)
+    mock.template stub<OVERLOADED_METHOD_KEY(mock, method, prototype)>(OVERLOADED_METHOD_PTR( mock , method, prototype )).setMethodDetails(#mock,#method)
 
 #define ConstOverloadedMethod(mock, method, prototype) \
-    mock.template stub<__COUNTER__>(CONST_OVERLOADED_METHOD_PTR( mock , method, prototype )).setMethodDetails(#mock,#method)
-
-#define Verify(...) \
-        Verify( __VA_ARGS__ ).setFileInfo(__FILE__, __LINE__, __func__)
-
-#define Using(...) \
-        Using( __VA_ARGS__ )
-
-#define VerifyNoOtherInvocations(...) \
-    VerifyNoOtherInvocations( __VA_ARGS__ ).setFileInfo(__FILE__, __LINE__, __func__)
+    mock.template stub<CONST_OVERLOADED_METHOD_KEY(mock, method, prototype)>(CONST_OVERLOADED_METHOD_PTR( mock , method, prototype )).setMethodDetails(#mock,#method)
+
+// Compile the mocking templates of a type once per binary, instead of once per translation unit.
+// Put FAKEIT_EXTERN_MOCK(type) in a header shared by the tests that mock the type,
+// and FAKEIT_INSTANTIATE_MOCK(type) in one .cpp file. Both are used at global scope.
+#define FAKEIT_EXTERN_MOCK(...) \
+    extern template class fakeit::Mock<__VA_ARGS__>; \
+    extern template class fakeit::MockImpl<__VA_ARGS__>; \
+    extern template struct fakeit::DynamicProxy<__VA_ARGS__>; \
+    extern template struct fakeit::VirtualTable<__VA_ARGS__>; \
+    extern template class fakeit::FakeObject<__VA_ARGS__>
+
+#define FAKEIT_INSTANTIATE_MOCK(...) \
+    template class fakeit::Mock<__VA_ARGS__>; \
+    template class fakeit::MockImpl<__VA_ARGS__>; \
+    template struct fakeit::DynamicProxy<__VA_ARGS__>; \
+    template struct fakeit::VirtualTable<__VA_ARGS__>; \
+    template class fakeit::FakeObject<__VA_ARGS__>
 
 #define Fake(...) \
     Fake( __VA_ARGS__ )
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "fakeit/SpyFunctor.hpp"
+#include "fakeit/FakeFunctor.hpp"
+#include "fakeit/WhenFunctor.hpp"
+
+namespace fakeit {
+
+    static SpyFunctor Spy;
+    static FakeFunctor Fake;
+    static WhenFunctor When;
+
+    template<class T>
+    class SilenceUnusedVariableWarnings {
+
+        void use(void *) {
+        }
+
+        SilenceUnusedVariableWarnings() {
+            use(&Fake);
+            use(&When);
+            use(&Spy);
+            use(&_);
+        }
+    };
+
+}
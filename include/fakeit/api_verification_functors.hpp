@@ -0,0 +1,32 @@
+#pragma once
+
+#include "fakeit/UsingFunctor.hpp"
+#include "fakeit/VerifyFunctor.hpp"
+#include "fakeit/VerifyNoOtherInvocationsFunctor.hpp"
+#include "fakeit/UnverifiedFunctor.hpp"
+#include "fakeit/CheckFunctor.hpp"
+
+namespace fakeit {
+
+    static UsingFunctor Using(Fakeit);
+    static VerifyFunctor Verify(Fakeit);
+    static VerifyNoOtherInvocationsFunctor VerifyNoOtherInvocations(Fakeit);
+    static UnverifiedFunctor Unverified(Fakeit);
+    static CheckFunctor Check;
+
+    template<class T>
+    class SilenceUnusedVerificationVariableWarnings {
+
+        void use(void *) {
+        }
+
+        SilenceUnusedVerificationVariableWarnings() {
+            use(&Using);
+            use(&Verify);
+            use(&VerifyNoOtherInvocations);
+            use(&Unverified);
+            use(&Check);
+        }
+    };
+
+}
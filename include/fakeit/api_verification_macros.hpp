@@ -0,0 +1,12 @@
+#pragma once
+
+// Must be included after all the code that declares Verify, Using & VerifyNoOtherInvocations.
+
+#define Verify(...) \
+        Verify( __VA_ARGS__ ).setFileInfo(__FILE__, __LINE__, __func__)
+
+#define Using(...) \
+        Using( __VA_ARGS__ )
+
+#define VerifyNoOtherInvocations(...) \
+    VerifyNoOtherInvocations( __VA_ARGS__ ).setFileInfo(__FILE__, __LINE__, __func__)
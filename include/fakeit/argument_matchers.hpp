@@ -8,6 +8,16 @@
  */
 #pragma once
 
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 namespace fakeit {
 
     struct IMatcher : Destructible {
@@ -20,6 +30,11 @@ namespace fakeit {
         virtual bool matches(const T &actual) const = 0;
     };
 
+    /**
+     * A creator may also define a non virtual createInlineMatcher() that returns its matcher by value.
+     * Using(...) then keeps the matcher inline and calls it without virtual dispatch.
+     * Creators without it fall back to createMatcher().
+     */
     template<typename T>
     struct TypedMatcherCreator {
 
@@ -71,6 +86,10 @@ namespace fakeit {
                 return new Matcher();
             }
 
+            Matcher createInlineMatcher() const {
+                return Matcher();
+            }
+
         };
 
         template<typename T>
@@ -100,6 +119,10 @@ namespace fakeit {
                 return new Matcher(this->_expected);
             }
 
+            Matcher createInlineMatcher() const {
+                return Matcher(this->_expected);
+            }
+
         };
 
         template<typename T>
@@ -128,6 +151,10 @@ namespace fakeit {
             virtual TypedMatcher<T> *createMatcher() const override {
                 return new Matcher(this->_expected);
             }
+
+            Matcher createInlineMatcher() const {
+                return Matcher(this->_expected);
+            }
         };
 
         template<typename T>
@@ -156,6 +183,10 @@ namespace fakeit {
             virtual TypedMatcher<T> *createMatcher() const override {
                 return new Matcher(this->_expected);
             }
+
+            Matcher createInlineMatcher() const {
+                return Matcher(this->_expected);
+            }
         };
 
         template<typename T>
@@ -185,6 +216,10 @@ namespace fakeit {
                 return new Matcher(this->_expected);
             }
 
+            Matcher createInlineMatcher() const {
+                return Matcher(this->_expected);
+            }
+
         };
 
         template<typename T>
@@ -214,6 +249,10 @@ namespace fakeit {
                 return new Matcher(this->_expected);
             }
 
+            Matcher createInlineMatcher() const {
+                return Matcher(this->_expected);
+            }
+
         };
 
         template<typename T>
@@ -244,6 +283,255 @@ namespace fakeit {
                 return new Matcher(this->_expected);
             }
 
+            Matcher createInlineMatcher() const {
+                return Matcher(this->_expected);
+            }
+
+        };
+
+        template<typename T>
+        struct has_less_operator {
+            template<typename U>
+            static auto test(int) -> decltype(std::declval<const U &>() < std::declval<const U &>(), std::true_type());
+
+            template<typename U>
+            static std::false_type test(...);
+
+            static const bool value = decltype(test<T>(0))::value;
+        };
+
+        template<typename T>
+        struct is_hashed_value : std::integral_constant<bool,
+                std::is_integral<T>::value || std::is_pointer<T>::value || std::is_same<T, std::string>::value> {
+        };
+
+        /**
+         * The values of an In/NotIn matcher, indexed once when the matcher is created:
+         * a hash set for integral, pointer and string values, an ordered set for other ordered values,
+         * and a plain vector (linear lookup) for values that only have ==.
+         */
+        template<typename T, typename Enable = void>
+        struct ValueSet;
+
+        template<typename T>
+        struct ValueSet<T, typename std::enable_if<is_hashed_value<T>::value>::type> {
+            template<typename Iterator>
+            ValueSet(Iterator begin, Iterator end)
+                    : _values(begin, end) {
+            }
+
+            bool contains(const T &value) const {
+                return _values.find(value) != _values.end();
+            }
+
+        private:
+            std::unordered_set<T> _values;
+        };
+
+        template<typename T>
+        struct ValueSet<T, typename std::enable_if<!is_hashed_value<T>::value && has_less_operator<T>::value>::type> {
+            template<typename Iterator>
+            ValueSet(Iterator begin, Iterator end)
+                    : _values(begin, end) {
+            }
+
+            bool contains(const T &value) const {
+                return _values.find(value) != _values.end();
+            }
+
+        private:
+            std::set<T> _values;
+        };
+
+        template<typename T>
+        struct ValueSet<T, typename std::enable_if<!is_hashed_value<T>::value && !has_less_operator<T>::value>::type> {
+            template<typename Iterator>
+            ValueSet(Iterator begin, Iterator end)
+                    : _values(begin, end) {
+            }
+
+            bool contains(const T &value) const {
+                for (const T &v : _values) {
+                    if (v == value)
+                        return true;
+                }
+                return false;
+            }
+
+        private:
+            std::vector<T> _values;
+        };
+
+        /**
+         * In (IsIn=true) and NotIn (IsIn=false).
+         * The values are indexed once, by the creator, and shared by all the matchers it creates.
+         */
+        template<typename T, bool IsIn>
+        struct InMatcherCreator : public TypedMatcherCreator<T> {
+
+            // the number of values listed by format().
+            static const std::size_t FORMATTED_VALUES = 5;
+
+            virtual ~InMatcherCreator() = default;
+
+            template<typename Iterator>
+            InMatcherCreator(Iterator begin, Iterator end)
+                    : _values(std::make_shared<ValueSet<T>>(begin, end)),
+                      _description(describe(begin, end)) {
+            }
+
+            struct Matcher : public TypedMatcher<T> {
+                Matcher(const std::shared_ptr<const ValueSet<T>> &values, const std::string &description)
+                        : _values(values), _description(description) {
+                }
+
+                virtual bool matches(const T &actual) const override {
+                    return _values->contains(actual) == IsIn;
+                }
+
+                virtual std::string format() const override {
+                    return _description;
+                }
+
+                const std::shared_ptr<const ValueSet<T>> _values;
+                const std::string _description;
+            };
+
+            virtual TypedMatcher<T> *createMatcher() const override {
+                return new Matcher(_values, _description);
+            }
+
+            Matcher createInlineMatcher() const {
+                return Matcher(_values, _description);
+            }
+
+        private:
+
+            template<typename Iterator>
+            static std::string describe(Iterator begin, Iterator end) {
+                std::string out = IsIn ? "In(" : "NotIn(";
+                std::size_t count = 0;
+                for (Iterator i = begin; i != end; ++i, ++count) {
+                    if (count == FORMATTED_VALUES) {
+                        out += ", ...";
+                        break;
+                    }
+                    if (count > 0) out += ", ";
+                    out += TypeFormatter<T>::format(*i);
+                }
+                return out + ")";
+            }
+
+            const std::shared_ptr<const ValueSet<T>> _values;
+            const std::string _description;
+        };
+
+        template<typename T>
+        struct BetweenMatcherCreator : public TypedMatcherCreator<T> {
+
+            virtual ~BetweenMatcherCreator() = default;
+
+            BetweenMatcherCreator(const T &low, const T &high)
+                    : _low(low), _high(high) {
+            }
+
+            struct Matcher : public TypedMatcher<T> {
+                Matcher(const T &low, const T &high)
+                        : _low(low), _high(high) {
+                }
+
+                virtual bool matches(const T &actual) const override {
+                    return !(actual < _low) && !(_high < actual);
+                }
+
+                virtual std::string format() const override {
+                    return std::string("Between(") + TypeFormatter<T>::format(_low) + ", " +
+                           TypeFormatter<T>::format(_high) + ")";
+                }
+
+                const T _low;
+                const T _high;
+            };
+
+            virtual TypedMatcher<T> *createMatcher() const override {
+                return new Matcher(_low, _high);
+            }
+
+            Matcher createInlineMatcher() const {
+                return Matcher(_low, _high);
+            }
+
+        private:
+            const T _low;
+            const T _high;
+        };
+
+        // Capture(container) pushes the captured values back into the container.
+        template<typename Container>
+        struct ContainerSink {
+            ContainerSink(Container &container)
+                    : _container(&container) {
+            }
+
+            template<typename V>
+            void operator()(V &&value) const {
+                _container->push_back(std::forward<V>(value));
+            }
+
+        private:
+            Container *_container;
+        };
+
+        /**
+         * Matches any value. When the invocation is dispatched to the behavior it selected, the argument is
+         * passed to the sink: moved when the argument is owned by an invocation that is not recorded
+         * (see setInvocationHistoryEnabled), copied otherwise.
+         * Nothing is captured while verifying.
+         */
+        template<typename T, typename Sink>
+        struct CaptureMatcherCreator : public TypedMatcherCreator<T> {
+
+            virtual ~CaptureMatcherCreator() = default;
+
+            CaptureMatcherCreator(const Sink &sink)
+                    : _sink(sink) {
+            }
+
+            struct Matcher : public TypedMatcher<T> {
+                Matcher(const Sink &sink)
+                        : _sink(sink) {
+                }
+
+                virtual bool matches(const T &) const override {
+                    return true;
+                }
+
+                virtual std::string format() const override {
+                    return "Capture";
+                }
+
+                template<typename A>
+                void capture(A &actual, bool canMove) const {
+                    if (canMove) {
+                        _sink(std::move(actual));
+                    } else {
+                        _sink(static_cast<const A &>(actual));
+                    }
+                }
+
+                mutable Sink _sink;
+            };
+
+            virtual TypedMatcher<T> *createMatcher() const override {
+                return new Matcher(_sink);
+            }
+
+            Matcher createInlineMatcher() const {
+                return Matcher(_sink);
+            }
+
+        private:
+            const Sink _sink;
         };
     }
 
@@ -292,4 +580,54 @@ namespace fakeit {
         return rv;
     }
 
+    template<typename Container>
+    internal::InMatcherCreator<typename Container::value_type, true> In(const Container &values) {
+        internal::InMatcherCreator<typename Container::value_type, true> rv(std::begin(values), std::end(values));
+        return rv;
+    }
+
+    template<typename T>
+    internal::InMatcherCreator<T, true> In(std::initializer_list<T> values) {
+        internal::InMatcherCreator<T, true> rv(values.begin(), values.end());
+        return rv;
+    }
+
+    template<typename Container>
+    internal::InMatcherCreator<typename Container::value_type, false> NotIn(const Container &values) {
+        internal::InMatcherCreator<typename Container::value_type, false> rv(std::begin(values), std::end(values));
+        return rv;
+    }
+
+    template<typename T>
+    internal::InMatcherCreator<T, false> NotIn(std::initializer_list<T> values) {
+        internal::InMatcherCreator<T, false> rv(values.begin(), values.end());
+        return rv;
+    }
+
+    template<typename T>
+    internal::BetweenMatcherCreator<T> Between(const T &low, const T &high) {
+        internal::BetweenMatcherCreator<T> rv(low, high);
+        return rv;
+    }
+
+    /**
+     * Captures the argument into out (anything with push_back) on each invocation dispatched through this Using(...).
+     */
+    template<typename Container>
+    internal::CaptureMatcherCreator<typename Container::value_type, internal::ContainerSink<Container>>
+    Capture(Container &out) {
+        internal::CaptureMatcherCreator<typename Container::value_type, internal::ContainerSink<Container>> rv(
+                (internal::ContainerSink<Container>(out)));
+        return rv;
+    }
+
+    /**
+     * Like Capture, but calls sink with the argument: an rvalue when it can be moved, a const T& otherwise.
+     */
+    template<typename T, typename Sink>
+    internal::CaptureMatcherCreator<T, Sink> CaptureInto(const Sink &sink) {
+        internal::CaptureMatcherCreator<T, Sink> rv(sink);
+        return rv;
+    }
+
 }
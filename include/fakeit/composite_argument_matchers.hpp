@@ -0,0 +1,346 @@
+/*
+ * composite_argument_matchers.hpp
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "mockutils/type_utils.hpp"
+#include "fakeit/argument_matchers.hpp"
+#include "fakeit/MatchersCollector.hpp"
+
+namespace fakeit {
+
+    /**
+     * How often one child of a composite matcher was evaluated, how often it decided the result
+     * (false in And, true in Or), and how long it took on the sampled evaluations.
+     */
+    struct MatcherStats {
+        unsigned long evaluations = 0;
+        unsigned long decisions = 0;
+        unsigned long timedEvaluations = 0;
+        double totalNanos = 0;
+
+        double averageNanos() const {
+            return timedEvaluations ? totalNanos / timedEvaluations : 1;
+        }
+
+        // expected cost of reaching a decision through this child, lower is evaluated first.
+        double score() const {
+            return averageNanos() * (evaluations + 1) / (decisions + 1);
+        }
+    };
+
+    namespace internal {
+
+        template<typename T>
+        struct type_tag {
+            typedef T type;
+        };
+
+        template<typename T>
+        type_tag<T> matcherArgTypeOf(const TypedMatcherCreator<T> &);
+
+        // the argument type T of a TypedMatcherCreator<T>.
+        template<typename Creator>
+        using MatcherArgType = typename decltype(matcherArgTypeOf(std::declval<const Creator &>()))::type;
+
+        // true if the matcher takes its argument once the invocation is dispatched (see Capture).
+        template<typename Matcher, typename T>
+        struct is_capturing_matcher {
+            template<typename M>
+            static auto test(int) -> decltype(std::declval<const M &>().capture(std::declval<T &>(), true), std::true_type());
+
+            template<typename M>
+            static std::false_type test(...);
+
+            static const bool value = decltype(test<Matcher>(0))::value;
+        };
+
+        template<bool ... values>
+        struct count_true;
+
+        template<>
+        struct count_true<> {
+            static const std::size_t value = 0;
+        };
+
+        template<bool first, bool ... rest>
+        struct count_true<first, rest...> {
+            static const std::size_t value = (first ? 1 : 0) + count_true<rest...>::value;
+        };
+
+        /**
+         * And (IsAnd=true) or Or (IsAnd=false) of the child matchers, held inline.
+         * The children are evaluated cheapest and most decisive first: every REORDER_INTERVAL
+         * evaluations the order is updated from the collected stats.
+         * Timing every call would cost more than a cheap child, so only one in TIMING_INTERVAL evaluations is timed.
+         * Children of And may capture the argument, as all of them matched a dispatched invocation.
+         */
+        template<typename T, bool IsAnd, typename ... ChildMatchers>
+        struct CompositeMatcher : public TypedMatcher<T> {
+
+            static const std::size_t CHILDREN = sizeof...(ChildMatchers);
+            static const std::size_t CAPTURING_CHILDREN = count_true<is_capturing_matcher<ChildMatchers, T>::value...>::value;
+            static const unsigned long TIMING_INTERVAL = 16;
+            static const unsigned long REORDER_INTERVAL = 64;
+
+            static_assert(IsAnd || CAPTURING_CHILDREN == 0,
+                          "Capture can't be used in Or, it is not known which children matched");
+
+            CompositeMatcher(ChildMatchers &&... children)
+                    : _children(std::move(children)...), _evaluations(0) {
+                for (std::size_t i = 0; i < CHILDREN; i++) {
+                    _order[i] = i;
+                }
+            }
+
+            virtual bool matches(const T &actual) const override {
+                const ChildMatch *childMatch = childMatchTable(make_index_sequence<CHILDREN>());
+                bool timed = _evaluations % TIMING_INTERVAL == 0;
+                bool result = IsAnd;
+                for (std::size_t k = 0; k < CHILDREN; k++) {
+                    std::size_t i = _order[k];
+                    MatcherStats &stats = _stats[i];
+                    bool childResult;
+                    if (timed) {
+                        auto start = std::chrono::steady_clock::now();
+                        childResult = childMatch[i](_children, actual);
+                        stats.totalNanos += std::chrono::duration<double, std::nano>(
+                                std::chrono::steady_clock::now() - start).count();
+                        stats.timedEvaluations++;
+                    } else {
+                        childResult = childMatch[i](_children, actual);
+                    }
+                    stats.evaluations++;
+                    if (childResult != IsAnd) {
+                        stats.decisions++;
+                        result = !IsAnd;
+                        break;
+                    }
+                }
+                if (++_evaluations % REORDER_INTERVAL == 0) {
+                    reorder();
+                }
+                return result;
+            }
+
+            virtual std::string format() const override {
+                std::string out = IsAnd ? "And(" : "Or(";
+                formatChildren(out, make_index_sequence<CHILDREN>());
+                return out + ")";
+            }
+
+            const MatcherStats &getStats(std::size_t child) const {
+                return _stats[child];
+            }
+
+            // passes the argument to the children that capture it. Only a single one may move it.
+            template<typename A, std::size_t Capturing = CAPTURING_CHILDREN>
+            typename std::enable_if<(Capturing > 0)>::type capture(A &actual, bool canMove) const {
+                captureChildren(actual, canMove && CAPTURING_CHILDREN == 1, make_index_sequence<CHILDREN>());
+            }
+
+        private:
+
+            template<typename A, std::size_t ... I>
+            void captureChildren(A &actual, bool canMove, index_sequence<I...>) const {
+                int expand[] = {0, ((void) captureChild(std::get<I>(_children), actual, canMove, 0), 0)...};
+                (void) expand;
+                (void) actual;
+                (void) canMove;
+            }
+
+            template<typename M, typename A>
+            static auto captureChild(const M &child, A &actual, bool canMove, int)
+            -> decltype(child.capture(actual, canMove), void()) {
+                child.capture(actual, canMove);
+            }
+
+            template<typename M, typename A>
+            static void captureChild(const M &, A &, bool, long) {
+            }
+
+            typedef std::tuple<ChildMatchers...> Children;
+            typedef bool (*ChildMatch)(const Children &, const T &);
+
+            template<std::size_t I>
+            static bool matchChild(const Children &children, const T &actual) {
+                typedef typename std::tuple_element<I, Children>::type M;
+                return std::get<I>(children).M::matches(actual);
+            }
+
+            template<std::size_t ... I>
+            static const ChildMatch *childMatchTable(index_sequence<I...>) {
+                static const ChildMatch table[] = {&matchChild<I>...};
+                return table;
+            }
+
+            template<std::size_t ... I>
+            void formatChildren(std::string &out, index_sequence<I...>) const {
+                int expand[] = {0, ((void) (out += (I == 0 ? "" : ", ") + std::get<I>(_children).format()), 0)...};
+                (void) expand;
+            }
+
+            // insertion sort, there are only a few children.
+            void reorder() const {
+                for (std::size_t k = 1; k < CHILDREN; k++) {
+                    std::size_t i = _order[k];
+                    double score = _stats[i].score();
+                    std::size_t j = k;
+                    for (; j > 0 && _stats[_order[j - 1]].score() > score; j--) {
+                        _order[j] = _order[j - 1];
+                    }
+                    _order[j] = i;
+                }
+            }
+
+            const Children _children;
+            mutable std::array<std::size_t, CHILDREN> _order;
+            mutable std::array<MatcherStats, CHILDREN> _stats;
+            mutable unsigned long _evaluations;
+        };
+
+        template<typename T, bool IsAnd, typename ... ChildCreators>
+        struct CompositeMatcherCreator : public TypedMatcherCreator<T> {
+
+            typedef CompositeMatcher<T, IsAnd, typename InlineMatcherOf<T, ChildCreators>::type...> Matcher;
+
+            virtual ~CompositeMatcherCreator() = default;
+
+            CompositeMatcherCreator(const ChildCreators &... children)
+                    : _children(children...) {
+            }
+
+            virtual TypedMatcher<T> *createMatcher() const override {
+                return new Matcher(createInlineMatcher());
+            }
+
+            Matcher createInlineMatcher() const {
+                return createChildMatchers(make_index_sequence<sizeof...(ChildCreators)>());
+            }
+
+        private:
+
+            template<std::size_t ... I>
+            Matcher createChildMatchers(index_sequence<I...>) const {
+                return Matcher(InlineMatcherOf<T, ChildCreators>::create(std::get<I>(_children))...);
+            }
+
+            const std::tuple<ChildCreators...> _children;
+        };
+
+        template<typename T, typename ChildCreator>
+        struct NotMatcherCreator : public TypedMatcherCreator<T> {
+
+            typedef typename InlineMatcherOf<T, ChildCreator>::type ChildMatcher;
+
+            static_assert(!is_capturing_matcher<ChildMatcher, T>::value,
+                          "Capture can't be used in Not, a dispatched invocation never matched it");
+
+            virtual ~NotMatcherCreator() = default;
+
+            NotMatcherCreator(const ChildCreator &child)
+                    : _child(child) {
+            }
+
+            struct Matcher : public TypedMatcher<T> {
+                Matcher(ChildMatcher &&child)
+                        : _child(std::move(child)) {
+                }
+
+                virtual bool matches(const T &actual) const override {
+                    return !_child.ChildMatcher::matches(actual);
+                }
+
+                virtual std::string format() const override {
+                    return std::string("Not(") + _child.format() + ")";
+                }
+
+                const ChildMatcher _child;
+            };
+
+            virtual TypedMatcher<T> *createMatcher() const override {
+                return new Matcher(createInlineMatcher());
+            }
+
+            Matcher createInlineMatcher() const {
+                return Matcher(InlineMatcherOf<T, ChildCreator>::create(_child));
+            }
+
+            const ChildCreator _child;
+        };
+
+        template<typename T, typename F>
+        struct PredMatcherCreator : public TypedMatcherCreator<T> {
+
+            virtual ~PredMatcherCreator() = default;
+
+            PredMatcherCreator(const F &predicate)
+                    : _predicate(predicate) {
+            }
+
+            struct Matcher : public TypedMatcher<T> {
+                Matcher(const F &predicate)
+                        : _predicate(predicate) {
+                }
+
+                virtual bool matches(const T &actual) const override {
+                    return _predicate(actual);
+                }
+
+                virtual std::string format() const override {
+                    return "Pred";
+                }
+
+                const F _predicate;
+            };
+
+            virtual TypedMatcher<T> *createMatcher() const override {
+                return new Matcher(_predicate);
+            }
+
+            Matcher createInlineMatcher() const {
+                return Matcher(_predicate);
+            }
+
+            const F _predicate;
+        };
+    }
+
+    template<typename Creator, typename ... Creators>
+    internal::CompositeMatcherCreator<internal::MatcherArgType<Creator>, true, Creator, Creators...>
+    And(const Creator &first, const Creators &... rest) {
+        return internal::CompositeMatcherCreator<internal::MatcherArgType<Creator>, true, Creator, Creators...>(first, rest...);
+    }
+
+    template<typename Creator, typename ... Creators>
+    internal::CompositeMatcherCreator<internal::MatcherArgType<Creator>, false, Creator, Creators...>
+    Or(const Creator &first, const Creators &... rest) {
+        return internal::CompositeMatcherCreator<internal::MatcherArgType<Creator>, false, Creator, Creators...>(first, rest...);
+    }
+
+    template<typename Creator>
+    internal::NotMatcherCreator<internal::MatcherArgType<Creator>, Creator> Not(const Creator &child) {
+        internal::NotMatcherCreator<internal::MatcherArgType<Creator>, Creator> rv(child);
+        return rv;
+    }
+
+    template<typename T, typename F>
+    internal::PredMatcherCreator<T, F> Pred(const F &predicate) {
+        internal::PredMatcherCreator<T, F> rv(predicate);
+        return rv;
+    }
+
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+// Mocking & stubbing only: Mock, When, Fake, Spy.
+// Verification (Verify, Check, Using, VerifyNoOtherInvocations, Unverified, CallBudget) is in fakeit_verification.hpp.
+#include "fakeit/Mock.hpp"
+#include "fakeit/api_stubbing_functors.hpp"
+#include "fakeit/api_macros.hpp"
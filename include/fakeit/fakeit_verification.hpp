@@ -0,0 +1,6 @@
+#pragma once
+
+#include "fakeit/fakeit_core.hpp"
+#include "fakeit/api_verification_functors.hpp"
+#include "fakeit/api_verification_macros.hpp"
+#include "fakeit/CallBudget.hpp"
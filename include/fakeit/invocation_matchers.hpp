@@ -12,6 +12,8 @@
 #include <tuple>
 #include <string>
 #include <iosfwd>
+#include <type_traits>
+#include <utility>
 
 #include "mockutils/TupleDispatcher.hpp"
 #include "mockutils/TuplePrinter.hpp"
@@ -19,6 +21,7 @@
 #include "mockutils/type_utils.hpp"
 #include "fakeit/ActualInvocation.hpp"
 #include "fakeit/argument_matchers.hpp"
+#include "fakeit/MatchersCollector.hpp"
 
 namespace fakeit {
 
@@ -41,15 +44,14 @@ namespace fakeit {
         }
 
         virtual std::string format() const override {
-            std::ostringstream out;
-            out << "(";
+            std::string out = "(";
             for (unsigned int i = 0; i < _matchers.size(); i++) {
-                if (i > 0) out << ", ";
+                if (i > 0) out += ", ";
                 IMatcher *m = dynamic_cast<IMatcher *>(_matchers[i]);
-                out << m->format();
+                out += m->format();
             }
-            out << ")";
-            return out.str();
+            out += ")";
+            return out;
         }
 
     private:
@@ -61,10 +63,11 @@ namespace fakeit {
 
             template<typename A>
             void operator()(int index, A &actualArg) {
+                if (!_matching)
+                    return;
                 TypedMatcher<typename naked_type<A>::type> *matcher =
-                        dynamic_cast<TypedMatcher<typename naked_type<A>::type> *>(_matchers[index]);
-                if (_matching)
-                    _matching = matcher->matches(actualArg);
+                        static_cast<TypedMatcher<typename naked_type<A>::type> *>(_matchers[index]);
+                _matching = matcher->matches(actualArg);
             }
 
             bool isMatching() {
@@ -85,6 +88,90 @@ namespace fakeit {
         const std::vector<Destructible *> _matchers;
     };
 
+    /**
+     * Matches the arguments with a tuple of concrete matchers, held inline.
+     * Each matcher is called directly (no virtual call), and matching stops at the first mismatch.
+     */
+    template<typename MatchersTuple, typename ... arglist>
+    struct TupleArgumentsMatcherInvocationMatcher : public ActualInvocation<arglist...>::Matcher {
+
+        virtual ~TupleArgumentsMatcherInvocationMatcher() = default;
+
+        TupleArgumentsMatcherInvocationMatcher(MatchersTuple &&matchers)
+                : _matchers(std::move(matchers)) {
+        }
+
+        virtual bool matches(ActualInvocation<arglist...> &invocation) override {
+            if (invocation.getActualMatcher() == this)
+                return true;
+            return matches(invocation.getActualArguments());
+        }
+
+        virtual std::string format() const override {
+            std::string out = "(";
+            formatMatchers(out, make_index_sequence<sizeof...(arglist)>());
+            out += ")";
+            return out;
+        }
+
+        virtual void dispatched(ArgumentsTuple<arglist...> &actualArguments, bool canMove) override {
+            dispatchArguments(actualArguments, canMove, make_index_sequence<sizeof...(arglist)>());
+        }
+
+    private:
+
+        bool matches(ArgumentsTuple<arglist...> &actualArguments) {
+            return matchArguments(actualArguments, make_index_sequence<sizeof...(arglist)>());
+        }
+
+        // lets the matchers that capture their argument (see Capture) take it.
+        template<std::size_t ... I>
+        void dispatchArguments(ArgumentsTuple<arglist...> &actualArguments, bool canMove, index_sequence<I...>) const {
+            int expand[] = {0, ((void) captureArgument(std::get<I>(_matchers), std::get<I>(actualArguments),
+                    canMove && !std::is_lvalue_reference<arglist>::value, 0), 0)...};
+            (void) expand;
+            (void) actualArguments;
+            (void) canMove;
+        }
+
+        template<typename M, typename A>
+        static auto captureArgument(const M &matcher, A &actualArg, bool canMove, int)
+        -> decltype(matcher.capture(actualArg, canMove), void()) {
+            matcher.capture(actualArg, canMove);
+        }
+
+        template<typename M, typename A>
+        static void captureArgument(const M &, A &, bool, long) {
+        }
+
+        template<std::size_t ... I>
+        bool matchArguments(ArgumentsTuple<arglist...> &actualArguments, index_sequence<I...>) const {
+#ifdef FAKEIT_CPP17
+            return (matchArgument(std::get<I>(_matchers), std::get<I>(actualArguments)) && ...);
+#else
+            bool matching = true;
+            int expand[] = {0, ((void) (matching = matching &&
+                    matchArgument(std::get<I>(_matchers), std::get<I>(actualArguments))), 0)...};
+            (void) expand;
+            return matching;
+#endif
+        }
+
+        template<std::size_t ... I>
+        void formatMatchers(std::string &out, index_sequence<I...>) const {
+            int expand[] = {0, ((void) (out.append(I == 0 ? "" : ", ") += std::get<I>(_matchers).format()), 0)...};
+            (void) expand;
+        }
+
+        // the qualified call binds statically, even though the built in matchers also implement TypedMatcher.
+        template<typename M, typename A>
+        static bool matchArgument(const M &matcher, const A &actualArg) {
+            return matcher.M::matches(actualArg);
+        }
+
+        const MatchersTuple _matchers;
+    };
+
 //template<typename ... arglist>
 //struct ExpectedArgumentsInvocationMatcher: public ActualInvocation<arglist...>::Matcher {
 //
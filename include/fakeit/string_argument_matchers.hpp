@@ -0,0 +1,237 @@
+/*
+ * string_argument_matchers.hpp
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+#pragma once
+
+// Not included by fakeit.hpp, <regex> is heavy. Include it after fakeit.hpp or fakeit_core.hpp.
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <regex>
+#include <string>
+
+#include "fakeit/argument_matchers.hpp"
+
+namespace fakeit {
+
+    namespace internal {
+
+        struct StringRef {
+            const char *data;
+            std::size_t size;
+        };
+
+        inline StringRef toStringRef(const std::string &s) {
+            return StringRef{s.data(), s.size()};
+        }
+
+        inline StringRef toStringRef(const char *s) {
+            return StringRef{s, std::strlen(s)};
+        }
+
+        inline bool isNull(const std::string &) {
+            return false;
+        }
+
+        inline bool isNull(const char *s) {
+            return s == nullptr;
+        }
+
+        inline bool startsWith(const StringRef &s, const std::string &prefix) {
+            return s.size >= prefix.size() && std::memcmp(s.data, prefix.data(), prefix.size()) == 0;
+        }
+
+        inline bool endsWith(const StringRef &s, const std::string &suffix) {
+            return s.size >= suffix.size() &&
+                   std::memcmp(s.data + s.size - suffix.size(), suffix.data(), suffix.size()) == 0;
+        }
+
+        /**
+         * The literal text every match of an ECMAScript pattern must start with (matched as a whole).
+         * Conservative: stops at the first special character, drops a literal that is followed by a quantifier,
+         * and gives up on alternation, case insensitive patterns and other grammars.
+         */
+        inline std::string literalPrefixOf(const std::string &pattern, std::regex_constants::syntax_option_type flags) {
+            const std::regex_constants::syntax_option_type otherGrammars =
+                    std::regex_constants::basic | std::regex_constants::extended | std::regex_constants::awk |
+                    std::regex_constants::grep | std::regex_constants::egrep;
+            if ((flags & otherGrammars) != 0 || (flags & std::regex_constants::icase) != 0 ||
+                pattern.find('|') != std::string::npos) {
+                return "";
+            }
+            std::size_t i = (!pattern.empty() && pattern[0] == '^') ? 1 : 0;
+            std::string prefix;
+            for (; i < pattern.size(); i++) {
+                char c = pattern[i];
+                if (std::strchr(".[]{}()\\*+?^$", c)) {
+                    if ((c == '*' || c == '?' || c == '{') && !prefix.empty()) {
+                        prefix.erase(prefix.size() - 1);
+                    }
+                    break;
+                }
+                prefix += c;
+            }
+            return prefix;
+        }
+
+        enum class StringMatch {
+            Equals, StartsWith, EndsWith, Contains
+        };
+
+        /**
+         * StrEq, StartsWith, EndsWith & Contains.
+         * T is the argument type of the method: std::string (the default) or const char*.
+         */
+        template<typename T, StringMatch Kind>
+        struct StringMatcherCreator : public TypedMatcherCreator<T> {
+
+            virtual ~StringMatcherCreator() = default;
+
+            StringMatcherCreator(const std::string &expected)
+                    : _expected(expected) {
+            }
+
+            struct Matcher : public TypedMatcher<T> {
+                Matcher(const std::string &expected)
+                        : _expected(expected) {
+                }
+
+                virtual bool matches(const T &actual) const override {
+                    if (isNull(actual))
+                        return false;
+                    StringRef s = toStringRef(actual);
+                    switch (Kind) {
+                        case StringMatch::Equals:
+                            return s.size == _expected.size() && startsWith(s, _expected);
+                        case StringMatch::StartsWith:
+                            return startsWith(s, _expected);
+                        case StringMatch::EndsWith:
+                            return endsWith(s, _expected);
+                        case StringMatch::Contains:
+                            return std::search(s.data, s.data + s.size, _expected.begin(), _expected.end()) !=
+                                   s.data + s.size;
+                    }
+                    return false;
+                }
+
+                virtual std::string format() const override {
+                    switch (Kind) {
+                        case StringMatch::Equals:
+                            return std::string("StrEq(\"") + _expected + "\")";
+                        case StringMatch::StartsWith:
+                            return std::string("StartsWith(\"") + _expected + "\")";
+                        case StringMatch::EndsWith:
+                            return std::string("EndsWith(\"") + _expected + "\")";
+                        case StringMatch::Contains:
+                            return std::string("Contains(\"") + _expected + "\")";
+                    }
+                    return "";
+                }
+
+                const std::string _expected;
+            };
+
+            virtual TypedMatcher<T> *createMatcher() const override {
+                return new Matcher(_expected);
+            }
+
+            Matcher createInlineMatcher() const {
+                return Matcher(_expected);
+            }
+
+        private:
+            const std::string _expected;
+        };
+
+        /**
+         * The whole argument matches a regular expression.
+         * The expression is compiled once, when the creator is built, and shared by all its matchers.
+         * A string that does not start with the literal prefix of the pattern is rejected without running the regex engine.
+         */
+        template<typename T>
+        struct RegexMatcherCreator : public TypedMatcherCreator<T> {
+
+            virtual ~RegexMatcherCreator() = default;
+
+            RegexMatcherCreator(const std::string &pattern, std::regex_constants::syntax_option_type flags)
+                    : _pattern(pattern),
+                      _prefix(literalPrefixOf(pattern, flags)),
+                      _regex(std::make_shared<std::regex>(pattern, flags)) {
+            }
+
+            struct Matcher : public TypedMatcher<T> {
+                Matcher(const std::string &pattern, const std::string &prefix, const std::shared_ptr<const std::regex> &regex)
+                        : _pattern(pattern), _prefix(prefix), _regex(regex) {
+                }
+
+                virtual bool matches(const T &actual) const override {
+                    if (isNull(actual))
+                        return false;
+                    StringRef s = toStringRef(actual);
+                    if (!startsWith(s, _prefix))
+                        return false;
+                    return std::regex_match(s.data, s.data + s.size, *_regex);
+                }
+
+                virtual std::string format() const override {
+                    return std::string("Matches(\"") + _pattern + "\")";
+                }
+
+                const std::string _pattern;
+                const std::string _prefix;
+                const std::shared_ptr<const std::regex> _regex;
+            };
+
+            virtual TypedMatcher<T> *createMatcher() const override {
+                return new Matcher(_pattern, _prefix, _regex);
+            }
+
+            Matcher createInlineMatcher() const {
+                return Matcher(_pattern, _prefix, _regex);
+            }
+
+        private:
+            const std::string _pattern;
+            const std::string _prefix;
+            const std::shared_ptr<const std::regex> _regex;
+        };
+    }
+
+    template<typename T = std::string>
+    internal::StringMatcherCreator<T, internal::StringMatch::Equals> StrEq(const std::string &expected) {
+        internal::StringMatcherCreator<T, internal::StringMatch::Equals> rv(expected);
+        return rv;
+    }
+
+    template<typename T = std::string>
+    internal::StringMatcherCreator<T, internal::StringMatch::StartsWith> StartsWith(const std::string &prefix) {
+        internal::StringMatcherCreator<T, internal::StringMatch::StartsWith> rv(prefix);
+        return rv;
+    }
+
+    template<typename T = std::string>
+    internal::StringMatcherCreator<T, internal::StringMatch::EndsWith> EndsWith(const std::string &suffix) {
+        internal::StringMatcherCreator<T, internal::StringMatch::EndsWith> rv(suffix);
+        return rv;
+    }
+
+    template<typename T = std::string>
+    internal::StringMatcherCreator<T, internal::StringMatch::Contains> Contains(const std::string &part) {
+        internal::StringMatcherCreator<T, internal::StringMatch::Contains> rv(part);
+        return rv;
+    }
+
+    template<typename T = std::string>
+    internal::RegexMatcherCreator<T> Matches(const std::string &pattern,
+            std::regex_constants::syntax_option_type flags = std::regex_constants::ECMAScript) {
+        internal::RegexMatcherCreator<T> rv(pattern, flags);
+        return rv;
+    }
+
+}
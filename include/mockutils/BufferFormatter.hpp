@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include "mockutils/Formatter.hpp"
+#include "mockutils/type_utils.hpp"
+
+namespace fakeit {
+
+    namespace internal {
+
+        template<typename T>
+        struct is_char_type : std::integral_constant<bool,
+                std::is_same<T, char>::value || std::is_same<T, signed char>::value ||
+                std::is_same<T, unsigned char>::value || std::is_same<T, wchar_t>::value ||
+                std::is_same<T, char16_t>::value || std::is_same<T, char32_t>::value> {
+        };
+
+        // true when T is formatted by one of the generic Formatters, not by a user specialization.
+        template<typename T>
+        struct has_default_formatter : std::is_base_of<DefaultFormatter, Formatter<T>> {
+        };
+
+        inline void appendUnsigned(std::string &out, unsigned long long val) {
+            char buf[24];
+            char *end = buf + sizeof(buf);
+            char *p = end;
+            do {
+                *--p = static_cast<char>('0' + val % 10);
+                val /= 10;
+            } while (val != 0);
+            out.append(p, end);
+        }
+
+        template<typename T>
+        void appendInteger(std::string &out, T val, std::true_type /* signed */) {
+            if (val < 0) {
+                out += '-';
+                appendUnsigned(out, 0ULL - static_cast<unsigned long long>(val));
+            } else {
+                appendUnsigned(out, static_cast<unsigned long long>(val));
+            }
+        }
+
+        template<typename T>
+        void appendInteger(std::string &out, T val, std::false_type /* signed */) {
+            appendUnsigned(out, static_cast<unsigned long long>(val));
+        }
+
+        // "%g" is what an ostream with the default flags and precision prints.
+        inline void appendFloatingPoint(std::string &out, double val) {
+            char buf[32];
+            int size = std::snprintf(buf, sizeof(buf), "%g", val);
+            out.append(buf, static_cast<std::size_t>(size));
+        }
+
+        inline void appendFloatingPoint(std::string &out, long double val) {
+            char buf[64];
+            int size = std::snprintf(buf, sizeof(buf), "%Lg", val);
+            out.append(buf, static_cast<std::size_t>(size));
+        }
+    }
+
+    /**
+     * Appends the text of a value to a string.
+     * Fakeit formats invocations and matchers through BufferFormatter, so one buffer is reused for a whole
+     * invocation instead of a std::ostringstream per argument.
+     * By default it uses Formatter<T>. Numbers, bool, char & std::string are converted directly, unless Formatter<T>
+     * was specialized by the user. Specialize BufferFormatter<T> to format a type without creating a temporary string.
+     */
+    template<typename T, class Enable = void>
+    struct BufferFormatter {
+        static void format(std::string &out, T const &val) {
+            out += Formatter<T>::format(val);
+        }
+    };
+
+    template<typename T>
+    struct BufferFormatter<T, typename std::enable_if<
+            std::is_integral<T>::value && !std::is_same<T, bool>::value && !internal::is_char_type<T>::value &&
+            internal::has_default_formatter<T>::value>::type> {
+        static void format(std::string &out, T const &val) {
+            internal::appendInteger(out, val, std::is_signed<T>());
+        }
+    };
+
+    template<typename T>
+    struct BufferFormatter<T, typename std::enable_if<
+            std::is_floating_point<T>::value && internal::has_default_formatter<T>::value>::type> {
+        static void format(std::string &out, T const &val) {
+            typedef typename std::conditional<std::is_same<T, long double>::value, long double, double>::type F;
+            internal::appendFloatingPoint(out, static_cast<F>(val));
+        }
+    };
+
+    template<>
+    struct BufferFormatter<bool> {
+        static void format(std::string &out, bool const &val) {
+            out += val ? "true" : "false";
+        }
+    };
+
+    template<>
+    struct BufferFormatter<char> {
+        static void format(std::string &out, char const &val) {
+            out += '\'';
+            out += val;
+            out += '\'';
+        }
+    };
+
+    template<typename T>
+    struct BufferFormatter<T, typename std::enable_if<
+            std::is_same<T, std::string>::value && internal::has_default_formatter<T>::value>::type> {
+        static void format(std::string &out, T const &val) {
+            out += val;
+        }
+    };
+
+    template<typename T>
+    using TypeBufferFormatter = BufferFormatter<typename fakeit::naked_type<T>::type>;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include "mockutils/type_utils.hpp"
+
+namespace fakeit {
+
+    /**
+     * Writes a value to the bytes of a call recording and reads it back (see CallRecorder and CallPlayer).
+     * Arithmetic types, enums and std::string have a codec. Specialize Codec<T> for other types, such as structs
+     * (their raw bytes would include padding, and pointers that mean nothing when the recording is replayed):
+     *
+     *   template<> struct Codec<Order> {
+     *       static void encode(std::string &out, const Order &val);
+     *       static Order decode(const char *&data, const char *end); // advances data past the value
+     *   };
+     *
+     * The bytes are in the layout of the machine that wrote them. Recorded arguments are found by their bytes,
+     * so a floating point argument matches the same bits: -0.0 is not 0.0, and a NaN matches the same NaN.
+     */
+    template<typename T, class Enable = void>
+    struct Codec {
+        static_assert(sizeof(T) == 0, "no fakeit::Codec for this type, specialize fakeit::Codec<T>");
+    };
+
+    namespace internal {
+
+        inline void checkEncodedSize(const char *data, const char *end, std::size_t size) {
+            if ((std::size_t) (end - data) < size)
+                throw std::runtime_error("truncated call recording");
+        }
+
+        template<typename ... arglist, std::size_t ... I>
+        void encodeTuple(std::string &out, const std::tuple<arglist...> &values, index_sequence<I...>) {
+            int expand[] = {0, ((void) Codec<typename naked_type<arglist>::type>::encode(out, std::get<I>(values)), 0)...};
+            (void) expand;
+            (void) out;
+            (void) values;
+        }
+    }
+
+    template<typename T>
+    struct Codec<T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type> {
+        static void encode(std::string &out, T const &val) {
+            out.append(reinterpret_cast<const char *>(&val), sizeof(T));
+        }
+
+        static T decode(const char *&data, const char *end) {
+            internal::checkEncodedSize(data, end, sizeof(T));
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+            std::memcpy(&storage, data, sizeof(T));
+            data += sizeof(T);
+            return *reinterpret_cast<T *>(&storage);
+        }
+    };
+
+    template<>
+    struct Codec<std::string> {
+        static void encode(std::string &out, std::string const &val) {
+            Codec<std::uint32_t>::encode(out, (std::uint32_t) val.size());
+            out += val;
+        }
+
+        static std::string decode(const char *&data, const char *end) {
+            std::uint32_t size = Codec<std::uint32_t>::decode(data, end);
+            internal::checkEncodedSize(data, end, size);
+            std::string val(data, size);
+            data += size;
+            return val;
+        }
+    };
+
+    /**
+     * Appends the values of a tuple one after the other, each through its Codec.
+     */
+    template<typename ... arglist>
+    void encodeTuple(std::string &out, const std::tuple<arglist...> &values) {
+        internal::encodeTuple(out, values, make_index_sequence<sizeof...(arglist)>());
+    }
+}
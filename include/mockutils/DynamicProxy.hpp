@@ -25,30 +25,14 @@ namespace fakeit {
 
     class InvocationHandlers : public InvocationHandlerCollection {
         std::vector<std::shared_ptr<Destructible>> &_methodMocks;
-        std::vector<unsigned int> &_offsets;
-
-        unsigned int getOffset(unsigned int id) const
-        {
-            unsigned int offset = 0;
-            for (; offset < _offsets.size(); offset++) {
-                if (_offsets[offset] == id) {
-                    break;
-                }
-            }
-            return offset;
-        }
 
     public:
-        InvocationHandlers(
-                std::vector<std::shared_ptr<Destructible>> &methodMocks,
-                std::vector<unsigned int> &offsets) :
-                _methodMocks(methodMocks), _offsets(offsets) {
+        InvocationHandlers(std::vector<std::shared_ptr<Destructible>> &methodMocks) :
+                _methodMocks(methodMocks) {
         }
 
-        Destructible *getInvocatoinHandlerPtrById(unsigned int id) override {
-            unsigned int offset = getOffset(id);
-            std::shared_ptr<Destructible> ptr = _methodMocks[offset];
-            return ptr.get();
+        Destructible *getInvocationHandlerPtrByOffset(unsigned int offset) override {
+            return _methodMocks[offset].get();
         }
 
     };
@@ -58,15 +42,18 @@ namespace fakeit {
 
         static_assert(std::is_polymorphic<C>::value, "DynamicProxy requires a polymorphic type");
 
-        DynamicProxy(C &inst) :
+        /**
+         * The instance keeps using its original virtual table until the first method is stubbed.
+         * Only then the table is cloned (copy on write), so creating a proxy does not depend on the size of the table.
+         * A fake instance may share its original table with other fakes of C. In that case pass isFake=true
+         * to have the cookies of the original table copied to the clone.
+         */
+        DynamicProxy(C &inst, bool isFake = false) :
                 instance(inst),
                 originalVtHandle(VirtualTable<C, baseclasses...>::getVTable(instance).createHandle()),
-                _methodMocks(VTUtils::getVTSize<C>()),
-                _offsets(VTUtils::getVTSize<C>()),
-                _invocationHandlers(_methodMocks, _offsets) {
-            _cloneVt.copyFrom(originalVtHandle.restore());
-            _cloneVt.setCookie(InvocationHandlerCollection::VT_COOKIE_INDEX, &_invocationHandlers);
-            getFake().setVirtualTable(_cloneVt);
+                _cloneVt(nullptr),
+                _isFake(isFake),
+                _invocationHandlers(_methodMocks) {
         }
 
         void detach() {
@@ -74,7 +61,7 @@ namespace fakeit {
         }
 
         ~DynamicProxy() {
-            _cloneVt.dispose();
+            disposeClone();
         }
 
         C &get() {
@@ -82,34 +69,38 @@ namespace fakeit {
         }
 
         void Reset() {
+            detach();
+            disposeClone();
 			_methodMocks = {};
-            _methodMocks.resize(VTUtils::getVTSize<C>());
             _members = {};
-			_offsets = {};
-            _offsets.resize(VTUtils::getVTSize<C>());
-            _cloneVt.copyFrom(originalVtHandle.restore());
+            _methodProxies = {};
+            _constantMethodProxies = {};
+            _constantValueSources = {};
+            _constantMethodOffsets = {};
+            _constantValues = {};
         }
 
 		void Clear()
         {
         }
 
-        template<int id, typename R, typename ... arglist>
-        void stubMethod(R(C::*vMethod)(arglist...), MethodInvocationHandler<R, arglist...> *methodInvocationHandler) {
-            auto offset = VTUtils::getOffset(vMethod);
-            MethodProxyCreator<R, arglist...> creator;
-            bind(creator.template createMethodProxy<id + 1>(offset), methodInvocationHandler);
+        void stubMethod(const MethodProxy &methodProxy, Destructible *methodInvocationHandler) {
+            cloneIfShared();
+            bind(methodProxy, methodInvocationHandler);
+            unsigned int offset = methodProxy.getOffset();
+            _constantMethodProxies[offset] = methodProxy.getConstantProxy();
+            _constantValueSources[offset] = dynamic_cast<ConstantReturnValueSource *>(methodInvocationHandler);
+            if (_constantMethodProxies[offset] && _constantValueSources[offset])
+                _constantMethodOffsets.push_back(offset);
         }
 
         void stubDtor(MethodInvocationHandler<void> *methodInvocationHandler) {
+            cloneIfShared();
             auto offset = VTUtils::getDestructorOffset<C>();
-            MethodProxyCreator<void> creator;
-            bindDtor(creator.createMethodProxy<0>(offset), methodInvocationHandler);
+            bindDtor(MethodProxyCreator<void>::createMethodProxy<DtorKey>(offset), methodInvocationHandler);
         }
 
-        template<typename R, typename ... arglist>
-        bool isMethodStubbed(R(C::*vMethod)(arglist...)) {
-            unsigned int offset = VTUtils::getOffset(vMethod);
+        bool isMethodStubbed(unsigned int offset) {
             return isBinded(offset);
         }
 
@@ -118,17 +109,37 @@ namespace fakeit {
             return isBinded(offset);
         }
 
-        template<typename R, typename ... arglist>
-        Destructible *getMethodMock(R(C::*vMethod)(arglist...)) {
-            auto offset = VTUtils::getOffset(vMethod);
-            std::shared_ptr<Destructible> ptr = _methodMocks[offset];
-            return ptr.get();
+        Destructible *getMethodMock(unsigned int offset) {
+            if (offset >= _methodMocks.size()) {
+                return nullptr;
+            }
+            return _methodMocks[offset].get();
         }
 
         Destructible *getDtorMock() {
             auto offset = VTUtils::getDestructorOffset<C>();
-            std::shared_ptr<Destructible> ptr = _methodMocks[offset];
-            return ptr.get();
+            return getMethodMock(offset);
+        }
+
+        /**
+         * Put the constant method proxy in the slot of the stubbed method if it currently returns
+         * the same value on every invocation, and the regular method proxy otherwise.
+         */
+        void refreshConstantMethodProxy(unsigned int offset) {
+            if (offset >= _constantValueSources.size() || !_constantValueSources[offset] || !_constantMethodProxies[offset]) {
+                return;
+            }
+            ConstantReturnValueSource *source = _constantValueSources[offset];
+            const void *value = source->getConstantReturnValue();
+            _constantValues[offset] = ConstantValue{value, value ? source->getConstantReturnCalls() : nullptr};
+            getFake().setMethod(offset, value ? _constantMethodProxies[offset] : _methodProxies[offset]);
+        }
+
+        // visits only the stubbed methods that have a constant method proxy.
+        void refreshConstantMethodProxies() {
+            for (unsigned int offset : _constantMethodOffsets) {
+                refreshConstantMethodProxy(offset);
+            }
         }
 
         template<typename DATA_TYPE, typename ... arglist>
@@ -159,6 +170,10 @@ namespace fakeit {
 
     private:
 
+        // identifies the destructor of C to MethodProxyCreator.
+        struct DtorKey {
+        };
+
         template<typename DATA_TYPE, typename ... arglist>
         class DataMemeberWrapper : public Destructible {
         private:
@@ -179,11 +194,17 @@ namespace fakeit {
 
         C &instance;
         typename VirtualTable<C, baseclasses...>::Handle originalVtHandle; // avoid delete!! this is the original!
-        VirtualTable<C, baseclasses...> _cloneVt;
+        VirtualTable<C, baseclasses...> *_cloneVt; // nullptr until the first method is stubbed
+        bool _isFake;
         //
+        // the following are sized to the virtual table when it is cloned.
         std::vector<std::shared_ptr<Destructible>> _methodMocks;
         std::vector<std::shared_ptr<Destructible>> _members;
-        std::vector<unsigned int> _offsets;
+        std::vector<void *> _methodProxies;
+        std::vector<void *> _constantMethodProxies;
+        std::vector<ConstantReturnValueSource *> _constantValueSources; // of _methodMocks, looked up once
+        std::vector<unsigned int> _constantMethodOffsets;
+        std::vector<ConstantValue> _constantValues;
         InvocationHandlers _invocationHandlers;
 
         FakeObject<C, baseclasses...> &getFake() {
@@ -192,20 +213,44 @@ namespace fakeit {
 
         void bind(const MethodProxy &methodProxy, Destructible *invocationHandler) {
             getFake().setMethod(methodProxy.getOffset(), methodProxy.getProxy());
+            _methodProxies[methodProxy.getOffset()] = methodProxy.getProxy();
             _methodMocks[methodProxy.getOffset()].reset(invocationHandler);
-            _offsets[methodProxy.getOffset()] = methodProxy.getId();
         }
 
         void bindDtor(const MethodProxy &methodProxy, Destructible *invocationHandler) {
             getFake().setDtor(methodProxy.getProxy());
             _methodMocks[methodProxy.getOffset()].reset(invocationHandler);
-            _offsets[methodProxy.getOffset()] = methodProxy.getId();
         }
 
-        template<typename DATA_TYPE>
-        DATA_TYPE getMethodMock(unsigned int offset) {
-            std::shared_ptr<Destructible> ptr = _methodMocks[offset];
-            return dynamic_cast<DATA_TYPE>(ptr.get());
+        void cloneIfShared() {
+            if (_cloneVt) {
+                return;
+            }
+            unsigned int size = VTUtils::getVTSize<C>();
+            _methodMocks.resize(size);
+            _methodProxies.resize(size);
+            _constantMethodProxies.resize(size);
+            _constantValueSources.resize(size);
+            _constantValues.resize(size);
+
+            VirtualTable<C, baseclasses...> &original = originalVtHandle.restore();
+            _cloneVt = new VirtualTable<C, baseclasses...>();
+            _cloneVt->copyFrom(original);
+            if (_isFake) {
+                _cloneVt->copyCookiesFrom(original);
+            }
+            _cloneVt->setCookie(InvocationHandlerCollection::VT_COOKIE_INDEX, &_invocationHandlers);
+            _cloneVt->setCookie(ConstantValueCollection::VT_COOKIE_INDEX, _constantValues.data());
+            getFake().setVirtualTable(*_cloneVt);
+        }
+
+        void disposeClone() {
+            if (!_cloneVt) {
+                return;
+            }
+            _cloneVt->dispose();
+            delete _cloneVt;
+            _cloneVt = nullptr;
         }
 
         template<typename BaseClass>
@@ -221,8 +266,7 @@ namespace fakeit {
         }
 
         bool isBinded(unsigned int offset) {
-            std::shared_ptr<Destructible> ptr = _methodMocks[offset];
-            return ptr.get() != nullptr;
+            return getMethodMock(offset) != nullptr;
         }
 
     };
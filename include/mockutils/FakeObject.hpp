@@ -39,14 +39,13 @@ namespace fakeit {
 
     public:
 
-        FakeObject() : vtable() {
+        /**
+         * The virtual table is shared, it is not disposed with the fake object.
+         */
+        FakeObject(VirtualTable<C, baseclasses...> &prototype) : vtable(prototype) {
             initializeDataMembersArea();
         }
 
-        ~FakeObject() {
-            vtable.dispose();
-        }
-
         void initializeDataMembersArea() {
             for (size_t i = 0; i < SIZE; ++i) instanceArea[i] = (char) 0;
         }
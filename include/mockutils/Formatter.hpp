@@ -8,6 +8,7 @@
 #pragma once
 
 #include <ostream>
+#include <string>
 #include "mockutils/type_utils.hpp"
 
 namespace fakeit {
@@ -15,6 +16,34 @@ namespace fakeit {
 	template<typename T, class Enable = void>
 	struct Formatter;
 
+	// base of the formatters fakeit provides for any type, tells BufferFormatter it may use a faster conversion.
+	struct DefaultFormatter {
+	};
+
+	namespace internal {
+
+		// an output stream buffer that appends to a string, so formatting with operator<< needs no <sstream>.
+		class StringStreamBuffer : public std::streambuf {
+			std::string &_out;
+
+		public:
+			explicit StringStreamBuffer(std::string &out) : _out(out) {
+			}
+
+		protected:
+			int_type overflow(int_type c) override {
+				if (!traits_type::eq_int_type(c, traits_type::eof()))
+					_out += traits_type::to_char_type(c);
+				return traits_type::not_eof(c);
+			}
+
+			std::streamsize xsputn(const char *s, std::streamsize n) override {
+				_out.append(s, static_cast<std::size_t>(n));
+				return n;
+			}
+		};
+	}
+
 	template <>
 	struct Formatter<bool>
 	{
@@ -38,7 +67,7 @@ namespace fakeit {
 	};
 
 	template<class C>
-	struct Formatter<C, typename std::enable_if<!is_ostreamable<C>::value>::type> {
+	struct Formatter<C, typename std::enable_if<!is_ostreamable<C>::value>::type> : public DefaultFormatter {
 		static std::string format(C const &)
 		{
 			return "?";
@@ -46,12 +75,14 @@ namespace fakeit {
 	};
 
 	template<class C>
-	struct Formatter<C, typename std::enable_if<is_ostreamable<C>::value>::type> {
+	struct Formatter<C, typename std::enable_if<is_ostreamable<C>::value>::type> : public DefaultFormatter {
 		static std::string format(C const &val)
 		{
-			std::ostringstream os;
+			std::string out;
+			internal::StringStreamBuffer buffer(out);
+			std::ostream os(&buffer);
 			os << val;
-			return os.str();
+			return out;
 		}
 	};
 
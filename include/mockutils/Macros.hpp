@@ -14,3 +14,12 @@
 #define THROWS throw(...)
 #define NO_THROWS
 #endif
+
+// the implementation switches to the standard library / language features of newer standards when they are available.
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define FAKEIT_CPP14
+#endif
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#define FAKEIT_CPP17
+#endif
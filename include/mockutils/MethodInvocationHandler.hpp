@@ -15,6 +15,20 @@ namespace fakeit {
     struct NoMoreRecordedActionException {
     };
 
+    struct ConstantReturnValueSource {
+        virtual ~ConstantReturnValueSource() = default;
+
+        /**
+         * Address of the value returned by every invocation, or nullptr if invocations must be dispatched to the handler.
+         */
+        virtual const void *getConstantReturnValue() = 0;
+
+        /**
+         * Counter of the invocations answered with the constant return value, they never reach the handler.
+         */
+        virtual unsigned long long *getConstantReturnCalls() = 0;
+    };
+
     template<typename R, typename ... arglist>
     struct MethodInvocationHandler : Destructible {
         virtual R handleMethodInvocation(const typename fakeit::production_arg<arglist>::type... args) = 0;
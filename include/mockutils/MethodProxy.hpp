@@ -6,27 +6,28 @@ namespace fakeit {
 
     struct MethodProxy {
 
-        MethodProxy(unsigned int id, unsigned int offset, void *vMethod) :
-                _id(id),
+        MethodProxy(unsigned int offset, void *vMethod, void *constantVMethod = nullptr) :
                 _offset(offset),
-                _vMethod(vMethod) {
+                _vMethod(vMethod),
+                _constantVMethod(constantVMethod) {
         }
 
         unsigned int getOffset() const {
             return _offset;
         }
 
-        unsigned int getId() const {
-            return _id;
-        }
-
         void *getProxy() const {
             return union_cast<void *>(_vMethod);
         }
 
+        // nullptr if the method can't return a constant value directly.
+        void *getConstantProxy() const {
+            return _constantVMethod;
+        }
+
     private:
-        unsigned int _id;
         unsigned int _offset;
         void *_vMethod;
+        void *_constantVMethod;
     };
-}
\ No newline at end of file
+}
@@ -1,5 +1,7 @@
 #pragma once
 #include <utility>
+#include <limits>
+#include <type_traits>
 
 #include "mockutils/type_utils.hpp"
 #include "mockutils/VirtualTable.hpp"
@@ -11,7 +13,7 @@ namespace fakeit {
     struct InvocationHandlerCollection {
         static const unsigned int VT_COOKIE_INDEX = 0;
 
-        virtual Destructible *getInvocatoinHandlerPtrById(unsigned int index) = 0;
+        virtual Destructible *getInvocationHandlerPtrByOffset(unsigned int offset) = 0;
 
         static InvocationHandlerCollection *getInvocationHandlerCollection(void *instance) {
             VirtualTableBase &vt = VirtualTableBase::getVTable(instance);
@@ -21,6 +23,43 @@ namespace fakeit {
         }
     };
 
+    // the value returned by the constant method proxy of a slot, and the counter of the calls it answered.
+    struct ConstantValue {
+        const void *value;
+        unsigned long long *calls;
+    };
+
+    struct ConstantValueCollection {
+        static const unsigned int VT_COOKIE_INDEX = 2;
+
+        static ConstantValue &getConstantValue(void *instance, unsigned int offset) {
+            VirtualTableBase &vt = VirtualTableBase::getVTable(instance);
+            ConstantValue *values = (ConstantValue *) vt.getCookie(ConstantValueCollection::VT_COOKIE_INDEX);
+            return values[offset];
+        }
+    };
+
+    template<typename R>
+    struct ConstantReturn {
+        static R get(const void *value) {
+            return *static_cast<typename std::remove_reference<R>::type *>(const_cast<void *>(value));
+        }
+    };
+
+    template<>
+    struct ConstantReturn<void> {
+        static void get(const void *) {
+        }
+    };
+
+
+    /**
+     * Identifies a method at compile time.
+     * All the Method(mock, method) expressions of the same method share one key, and therefore one set of proxies.
+     */
+    template<typename MemberType, MemberType method>
+    struct MethodKey {
+    };
 
     template<typename R, typename ... arglist>
     class MethodProxyCreator {
@@ -29,25 +68,59 @@ namespace fakeit {
 
     public:
 
-        template<unsigned int id>
-        MethodProxy createMethodProxy(unsigned int offset) {
-            return MethodProxy(id, offset, union_cast<void *>(&MethodProxyCreator::methodProxyX < id > ));
+        /**
+         * The proxies are instantiated once per Key, a type that identifies the method (see MethodKey).
+         * A method always has the same offset, so the proxies find the invocation handler by the offset they are bound to.
+         * The constant method proxy counts the call and returns the value stored for its slot in the
+         * ConstantValueCollection, without going through the invocation handler. It is nullptr if R can't be returned that way.
+         */
+        template<typename Key>
+        static MethodProxy createMethodProxy(unsigned int offset) {
+            boundOffsetOf<Key>() = offset;
+            return MethodProxy(offset, union_cast<void *>(&MethodProxyCreator::methodProxyX<Key>),
+                               constantMethodProxy<Key>(std::integral_constant<bool,
+                                       std::is_void<R>::value || std::is_reference<R>::value || std::is_copy_constructible<R>::value>()));
         }
 
     protected:
 
-        R methodProxy(unsigned int id, const typename fakeit::production_arg<arglist>::type... args) {
+        R methodProxy(unsigned int offset, const typename fakeit::production_arg<arglist>::type... args) {
             InvocationHandlerCollection *invocationHandlerCollection = InvocationHandlerCollection::getInvocationHandlerCollection(
                     this);
             MethodInvocationHandler<R, arglist...> *invocationHandler =
-                    (MethodInvocationHandler<R, arglist...> *) invocationHandlerCollection->getInvocatoinHandlerPtrById(
-                            id);
+                    (MethodInvocationHandler<R, arglist...> *) invocationHandlerCollection->getInvocationHandlerPtrByOffset(
+                            offset);
             return invocationHandler->handleMethodInvocation(std::forward<const typename fakeit::production_arg<arglist>::type>(args)...);
         }
 
-        template<int id>
+        template<typename Key>
         R methodProxyX(arglist ... args) {
-            return methodProxy(id, std::forward<const typename fakeit::production_arg<arglist>::type>(args)...);
+            return methodProxy(boundOffsetOf<Key>(), std::forward<const typename fakeit::production_arg<arglist>::type>(args)...);
+        }
+
+        template<typename Key>
+        R constantMethodProxyX(arglist ...) {
+            ConstantValue &constant = ConstantValueCollection::getConstantValue(this, boundOffsetOf<Key>());
+            ++*constant.calls;
+            return ConstantReturn<R>::get(constant.value);
+        }
+
+    private:
+
+        template<typename Key>
+        static unsigned int &boundOffsetOf() {
+            static unsigned int offset = std::numeric_limits<unsigned int>::max();
+            return offset;
+        }
+
+        template<typename Key>
+        static void *constantMethodProxy(std::true_type) {
+            return union_cast<void *>(&MethodProxyCreator::constantMethodProxyX<Key>);
+        }
+
+        template<typename Key>
+        static void *constantMethodProxy(std::false_type) {
+            return nullptr;
         }
     };
 }
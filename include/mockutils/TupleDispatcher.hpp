@@ -8,70 +8,61 @@
 #pragma once
 
 #include <tuple>
+#include <functional>
+#include <type_traits>
 
-namespace fakeit {
+#include "mockutils/type_utils.hpp"
 
-    template<int N>
-    struct apply_func {
-        template<typename R, typename ... ArgsF, typename ... ArgsT, typename ... Args>
-        static R applyTuple(std::function<R(ArgsF &...)> f, std::tuple<ArgsT...> &t, Args &... args) {
-            return apply_func<N - 1>::template applyTuple(f, t, std::get<N - 1>(t), args...);
-        }
-    };
-
-    template<>
-    struct apply_func < 0 > {
-        template<typename R, typename ... ArgsF, typename ... ArgsT, typename ... Args>
-        static R applyTuple(std::function<R(ArgsF &...)> f, std::tuple<ArgsT...> & /* t */, Args &... args) {
-            return f(args...);
-        }
-    };
+namespace fakeit {
 
+    /**
+     * The tuple elements are expanded with an index sequence, in one flat call.
+     * No recursion, and no copy of the function.
+     */
     struct TupleDispatcher {
 
-        template<typename R, typename ... ArgsF, typename ... ArgsT>
-        static R applyTuple(std::function<R(ArgsF &...)> f, std::tuple<ArgsT...> &t) {
-            return apply_func<sizeof...(ArgsT)>::template applyTuple(f, t);
-        }
-
         template<typename R, typename ...arglist>
-        static R invoke(std::function<R(arglist &...)> func, const std::tuple<arglist...> &arguments) {
+        static R invoke(const std::function<R(arglist &...)> &func, const std::tuple<arglist...> &arguments) {
             std::tuple<arglist...> &args = const_cast<std::tuple<arglist...> &>(arguments);
-            return applyTuple(func, args);
+            return applyTuple<R, arglist...>(func, args, make_index_sequence<sizeof...(arglist)>());
         }
 
         template<typename TupleType, typename FunctionType>
-        static void for_each(TupleType &&, FunctionType &,
-            std::integral_constant<size_t, std::tuple_size<typename std::remove_reference<TupleType>::type>::value>) {
+        static void for_each(TupleType &&t, FunctionType &f) {
+            for_each_element(t, f, make_index_sequence<std::tuple_size<typename std::remove_reference<TupleType>::type>::value>());
         }
 
-        template<std::size_t I, typename TupleType, typename FunctionType, typename = typename std::enable_if<
-            I != std::tuple_size<typename std::remove_reference<TupleType>::type>::value>::type>
-            static void for_each(TupleType &&t, FunctionType &f, std::integral_constant<size_t, I>) {
-            f(I, std::get < I >(t));
-            for_each(std::forward < TupleType >(t), f, std::integral_constant<size_t, I + 1>());
+        template<typename TupleType1, typename TupleType2, typename FunctionType>
+        static void for_each(TupleType1 &&t, TupleType2 &&t2, FunctionType &f) {
+            for_each_element(t, t2, f, make_index_sequence<std::tuple_size<typename std::remove_reference<TupleType1>::type>::value>());
         }
 
-        template<typename TupleType, typename FunctionType>
-        static void for_each(TupleType &&t, FunctionType &f) {
-            for_each(std::forward < TupleType >(t), f, std::integral_constant<size_t, 0>());
-        }
+    private:
 
-        template<typename TupleType1, typename TupleType2, typename FunctionType>
-        static void for_each(TupleType1 &&, TupleType2 &&, FunctionType &,
-            std::integral_constant<size_t, std::tuple_size<typename std::remove_reference<TupleType1>::type>::value>) {
+        template<typename R, typename ... arglist, std::size_t ... I>
+        static R applyTuple(const std::function<R(arglist &...)> &f, std::tuple<arglist...> &t, index_sequence<I...>) {
+            return f(std::get<I>(t)...);
         }
 
-        template<std::size_t I, typename TupleType1, typename TupleType2, typename FunctionType, typename = typename std::enable_if<
-            I != std::tuple_size<typename std::remove_reference<TupleType1>::type>::value>::type>
-            static void for_each(TupleType1 &&t, TupleType2 &&t2, FunctionType &f, std::integral_constant<size_t, I>) {
-            f(I, std::get < I >(t), std::get < I >(t2));
-            for_each(std::forward < TupleType1 >(t), std::forward < TupleType2 >(t2), f, std::integral_constant<size_t, I + 1>());
+        // f is called for each element in order.
+        template<typename TupleType, typename FunctionType, std::size_t ... I>
+        static void for_each_element(TupleType &t, FunctionType &f, index_sequence<I...>) {
+#ifdef FAKEIT_CPP17
+            (f(I, std::get<I>(t)), ...);
+#else
+            int expand[] = {0, ((void) f(I, std::get<I>(t)), 0)...};
+            (void) expand;
+#endif
         }
 
-        template<typename TupleType1, typename TupleType2, typename FunctionType>
-        static void for_each(TupleType1 &&t, TupleType2 &&t2, FunctionType &f) {
-            for_each(std::forward < TupleType1 >(t), std::forward < TupleType2 >(t2), f, std::integral_constant<size_t, 0>());
+        template<typename TupleType1, typename TupleType2, typename FunctionType, std::size_t ... I>
+        static void for_each_element(TupleType1 &t, TupleType2 &t2, FunctionType &f, index_sequence<I...>) {
+#ifdef FAKEIT_CPP17
+            (f(I, std::get<I>(t), std::get<I>(t2)), ...);
+#else
+            int expand[] = {0, ((void) f(I, std::get<I>(t), std::get<I>(t2)), 0)...};
+            (void) expand;
+#endif
         }
     };
-}
\ No newline at end of file
+}
@@ -7,43 +7,49 @@
  */
 #pragma once
 
-#include <iosfwd>
+#include <ostream>
 #include <tuple>
 #include <string>
-#include <sstream>
 #include "mockutils/Formatter.hpp"
+#include "mockutils/BufferFormatter.hpp"
+#include "mockutils/type_utils.hpp"
 
 namespace fakeit {
 
 // helper function to print a tuple of Any size
-    template<class Tuple, std::size_t N>
     struct TuplePrinter {
-        static void print(std::ostream &strm, const Tuple &t) {
-            TuplePrinter<Tuple, N - 1>::print(strm, t);
-            strm << ", " << fakeit::TypeFormatter<decltype(std::get<N - 1>(t))>::format(std::get<N - 1>(t));
-        }
-    };
 
-    template<class Tuple>
-    struct TuplePrinter<Tuple, 1> {
-        static void print(std::ostream &strm, const Tuple &t) {
-            strm << fakeit::TypeFormatter<decltype(std::get<0>(t))>::format(std::get<0>(t));
+        template<class Tuple, std::size_t ... I>
+        static void print(std::ostream &strm, const Tuple &t, index_sequence<I...>) {
+            int expand[] = {0, ((void) (strm << (I == 0 ? "" : ", ")
+                                       << fakeit::TypeFormatter<decltype(std::get<I>(t))>::format(std::get<I>(t))), 0)...};
+            (void) expand;
         }
-    };
 
-    template<class Tuple>
-    struct TuplePrinter<Tuple, 0> {
-        static void print(std::ostream &, const Tuple &) {
+        template<class Tuple, std::size_t ... I>
+        static void format(std::string &out, const Tuple &t, index_sequence<I...>) {
+            int expand[] = {0, ((void) out.append(I == 0 ? "" : ", "),
+                    fakeit::TypeBufferFormatter<decltype(std::get<I>(t))>::format(out, std::get<I>(t)), 0)...};
+            (void) expand;
+            (void) t;
         }
     };
 
     template<class ... Args>
     void print(std::ostream &strm, const std::tuple<Args...> &t) {
         strm << "(";
-        TuplePrinter<decltype(t), sizeof...(Args)>::print(strm, t);
+        TuplePrinter::print(strm, t, make_index_sequence<sizeof...(Args)>());
         strm << ")";
     }
 
+    // appends "(arg1, arg2, ...)" to out.
+    template<class ... Args>
+    void formatTuple(std::string &out, const std::tuple<Args...> &t) {
+        out += '(';
+        TuplePrinter::format(out, t, make_index_sequence<sizeof...(Args)>());
+        out += ')';
+    }
+
     template<class ... Args>
     std::ostream &operator<<(std::ostream &strm, const std::tuple<Args...> &t) {
         print(strm, t);
@@ -8,11 +8,16 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <stdexcept>
 #include <type_traits>
-#include "mockutils/VirtualOffestSelector.hpp"
 #include "mockutils/union_cast.hpp"
 
+#ifdef _MSC_VER
+#include "mockutils/VirtualOffestSelector.hpp"
+#endif
+
 namespace fakeit {
     class NoVirtualDtor {
     };
@@ -20,6 +25,8 @@ namespace fakeit {
     class VTUtils {
     public:
 
+#ifdef _MSC_VER
+
         template<typename C, typename R, typename ... arglist>
         static unsigned int getOffset(R (C::*vMethod)(arglist...)) {
             auto sMethod = reinterpret_cast<unsigned int (VirtualOffsetSelector::*)(int)>(vMethod);
@@ -27,12 +34,37 @@ namespace fakeit {
             return (offsetSelctor.*sMethod)(0);
         }
 
+#else
+
+        /**
+         * Itanium C++ ABI (GCC & Clang): a pointer to a virtual member function holds the offset
+         * of the method in the virtual table, in bytes. Decoding it is a plain bit operation.
+         * A pointer to a non virtual method holds its address instead, and is rejected.
+         */
+        template<typename C, typename R, typename ... arglist>
+        static unsigned int getOffset(R (C::*vMethod)(arglist...)) {
+            static_assert(sizeof(vMethod) == sizeof(ItaniumMemberFunctionPointer), "unexpected member function pointer layout");
+            ItaniumMemberFunctionPointer p = union_cast<ItaniumMemberFunctionPointer>(vMethod);
+#if defined(__arm__) || defined(__aarch64__)
+            // ARM variant: the virtual flag is kept in adj, ptr is the offset.
+            if ((p.adj & 1) == 0)
+                throw std::invalid_argument("method is not virtual");
+            return (unsigned int) (p.ptr / sizeof(void *));
+#else
+            // ptr is 1 + the offset.
+            if ((p.ptr & 1) == 0)
+                throw std::invalid_argument("method is not virtual");
+            return (unsigned int) ((p.ptr - 1) / sizeof(void *));
+#endif
+        }
+
+#endif
+
         template<typename C>
         static typename std::enable_if<std::has_virtual_destructor<C>::value, unsigned int>::type
         getDestructorOffset() {
-            VirtualOffsetSelector offsetSelctor;
-            union_cast<C *>(&offsetSelctor)->~C();
-            return offsetSelctor.offset;
+            static const unsigned int offset = selectDestructorOffset<C>();
+            return offset;
         }
 
         template<typename C>
@@ -43,6 +75,79 @@ namespace fakeit {
 
         template<typename C>
         static unsigned int getVTSize() {
+            static const unsigned int vtSize = selectVTSize<C>();
+            return vtSize;
+        }
+
+    private:
+
+        // the results of the following never change for a given type, they are cached by the getters above.
+
+#ifdef _MSC_VER
+
+        template<typename C>
+        static unsigned int selectDestructorOffset() {
+            VirtualOffsetSelector offsetSelctor;
+            union_cast<C *>(&offsetSelctor)->~C();
+            return offsetSelctor.offset;
+        }
+
+#else
+
+        struct ItaniumMemberFunctionPointer {
+            std::ptrdiff_t ptr;
+            std::ptrdiff_t adj;
+        };
+
+        // An object with a hand made virtual table, used to find which slot is called by ~C().
+        struct DestructorProbe {
+            void **vt;
+            bool isBelowBound;
+
+            void below() {
+                isBelowBound = true;
+            }
+
+            void above() {
+                isBelowBound = false;
+            }
+        };
+
+        /**
+         * A destructor has no member pointer to decode.
+         * Call ~C() on a probe whose table slots below a bound all point to one method, and the rest to another.
+         * Then move the bound, binary search style, until the slot is found.
+         */
+        template<typename C>
+        static unsigned int selectDestructorOffset() {
+            unsigned int size = getVTSize<C>();
+            void *belowPtr = union_cast<void *>(&DestructorProbe::below);
+            void *abovePtr = union_cast<void *>(&DestructorProbe::above);
+            void **vt = new void *[size];
+            DestructorProbe probe{vt, false};
+
+            unsigned int low = 0;
+            unsigned int high = size;
+            while (high - low > 1) {
+                unsigned int bound = low + (high - low) / 2;
+                for (unsigned int i = low; i < high; i++) {
+                    vt[i] = i < bound ? belowPtr : abovePtr;
+                }
+                union_cast<C *>(&probe)->~C();
+                if (probe.isBelowBound) {
+                    high = bound;
+                } else {
+                    low = bound;
+                }
+            }
+            delete[] vt;
+            return low;
+        }
+
+#endif
+
+        template<typename C>
+        static unsigned int selectVTSize() {
             struct Derrived : public C {
                 virtual void endOfVt() {
                 }
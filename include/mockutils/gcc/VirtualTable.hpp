@@ -81,6 +81,12 @@ namespace fakeit {
             }
         }
 
+        void copyCookiesFrom(VirtualTable<C, baseclasses...> &from) {
+            for (unsigned int i = 0; i < numOfCookies; i++) {
+                setCookie(i, from.getCookie(i));
+            }
+        }
+
         VirtualTable() :
                 VirtualTable(buildVTArray()) {
         }
@@ -136,7 +142,7 @@ namespace fakeit {
         }
 
     private:
-        static const unsigned int numOfCookies = 2;
+        static const unsigned int numOfCookies = 3;
 
         static void **buildVTArray() {
             int size = VTUtils::getVTSize<C>();
@@ -194,6 +194,12 @@ namespace fakeit {
             }
         }
 
+        void copyCookiesFrom(VirtualTable<C, baseclasses...> &from) {
+            for (unsigned int i = 0; i < numOfCookies; i++) {
+                setCookie(i, from.getCookie(i));
+            }
+        }
+
         VirtualTable() : VirtualTable(buildVTArray()) {
         }
 
@@ -255,7 +261,7 @@ namespace fakeit {
 
         static_assert(sizeof(unsigned int (SimpleType::*)()) == sizeof(unsigned int (C::*)()),
             "Can't mock a type with multiple inheritance or with non-polymorphic base class");
-        static const unsigned int numOfCookies = 3;
+        static const unsigned int numOfCookies = 4;
 
         static void **buildVTArray() {
             int vtSize = VTUtils::getVTSize<C>();
@@ -8,11 +8,43 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <tuple>
+#include <utility>
 
+#include "mockutils/Macros.hpp"
 
 namespace fakeit {
 
+#ifdef FAKEIT_CPP14
+
+    template<std::size_t ... I>
+    using index_sequence = std::index_sequence<I...>;
+
+    template<std::size_t N>
+    using make_index_sequence = std::make_index_sequence<N>;
+
+#else
+
+    // C++11 replacement of std::index_sequence.
+    template<std::size_t ... I>
+    struct index_sequence {
+    };
+
+    template<std::size_t N, std::size_t ... I>
+    struct make_index_sequence_impl : make_index_sequence_impl<N - 1, N - 1, I...> {
+    };
+
+    template<std::size_t ... I>
+    struct make_index_sequence_impl<0, I...> {
+        typedef index_sequence<I...> type;
+    };
+
+    template<std::size_t N>
+    using make_index_sequence = typename make_index_sequence_impl<N>::type;
+
+#endif
+
     template<class C>
     struct naked_type {
         typedef typename std::remove_cv<typename std::remove_reference<C>::type>::type type;
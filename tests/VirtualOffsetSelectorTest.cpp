@@ -11,6 +11,7 @@
 
 #include "tpunit++.hpp"
 #include "fakeit.hpp"
+#include "mockutils/VirtualOffestSelector.hpp"
 
 using namespace fakeit;
 
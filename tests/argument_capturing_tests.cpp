@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <string>
+#include <vector>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct ArgumentCapturingTests: tpunit::TestFixture {
+	ArgumentCapturingTests()
+			: tpunit::TestFixture(
+					//
+					TEST(ArgumentCapturingTests::capture_into_container),
+					TEST(ArgumentCapturingTests::capture_only_when_all_arguments_match),
+					TEST(ArgumentCapturingTests::capture_when_behavior_throws),
+					TEST(ArgumentCapturingTests::verification_does_not_capture),
+					TEST(ArgumentCapturingTests::copy_when_invocation_is_recorded),
+					TEST(ArgumentCapturingTests::move_when_invocation_is_not_recorded),
+					TEST(ArgumentCapturingTests::capture_within_And),
+					TEST(ArgumentCapturingTests::copy_into_several_captures_within_And),
+					TEST(ArgumentCapturingTests::format_Capture)
+			) //
+	{
+	}
+
+	struct Order {
+		int id;
+	};
+
+	struct OrderSink {
+		OrderSink(std::vector<std::string> &how)
+				: _how(&how) {
+		}
+
+		void operator()(Order &&) const {
+			_how->push_back("moved");
+		}
+
+		void operator()(const Order &) const {
+			_how->push_back("copied");
+		}
+
+		std::vector<std::string> *_how;
+	};
+
+	struct OrderService {
+		virtual int submit(Order order) = 0;
+		virtual void log(const std::string &message, int level) = 0;
+	};
+
+	void capture_into_container() {
+		Mock<OrderService> mock;
+		std::vector<std::string> messages;
+		When(Method(mock, log).Using(Capture(messages), _)).AlwaysReturn();
+
+		OrderService &i = mock.get();
+		i.log("a", 1);
+		i.log("b", 2);
+
+		ASSERT_EQUAL(2u, messages.size());
+		ASSERT_EQUAL(std::string("a"), messages[0]);
+		ASSERT_EQUAL(std::string("b"), messages[1]);
+		Verify(Method(mock, log)).Exactly(2);
+	}
+
+	void capture_only_when_all_arguments_match() {
+		Mock<OrderService> mock;
+		std::vector<std::string> messages;
+		When(Method(mock, log).Using(Capture(messages), Eq(2))).AlwaysReturn();
+
+		OrderService &i = mock.get();
+		ASSERT_THROW(i.log("a", 1), fakeit::UnexpectedMethodCallException);
+		i.log("b", 2);
+
+		ASSERT_EQUAL(1u, messages.size());
+		ASSERT_EQUAL(std::string("b"), messages[0]);
+	}
+
+	void capture_when_behavior_throws() {
+		Mock<OrderService> mock;
+		std::vector<std::string> messages;
+		When(Method(mock, log).Using(Capture(messages), _)).AlwaysThrow(std::string("error"));
+
+		OrderService &i = mock.get();
+		ASSERT_THROW(i.log("a", 1), std::string);
+
+		ASSERT_EQUAL(1u, messages.size());
+	}
+
+	void verification_does_not_capture() {
+		Mock<OrderService> mock;
+		Fake(Method(mock, log));
+
+		OrderService &i = mock.get();
+		i.log("a", 1);
+
+		std::vector<std::string> messages;
+		Verify(Method(mock, log).Using(Capture(messages), _)).Once();
+		ASSERT_EQUAL(0u, messages.size());
+	}
+
+	void copy_when_invocation_is_recorded() {
+		Mock<OrderService> mock;
+		std::vector<std::string> how;
+		When(Method(mock, submit).Using(CaptureInto<Order>(OrderSink(how)))).AlwaysReturn(1);
+
+		mock.get().submit(Order{1});
+
+		ASSERT_EQUAL(1u, how.size());
+		ASSERT_EQUAL(std::string("copied"), how[0]);
+	}
+
+	void move_when_invocation_is_not_recorded() {
+		Mock<OrderService> mock;
+		mock.DisableInvocationHistory();
+		std::vector<std::string> how;
+		When(Method(mock, submit).Using(CaptureInto<Order>(OrderSink(how)))).AlwaysReturn(1);
+
+		mock.get().submit(Order{1});
+
+		ASSERT_EQUAL(1u, how.size());
+		ASSERT_EQUAL(std::string("moved"), how[0]);
+	}
+
+	void capture_within_And() {
+		Mock<OrderService> mock;
+		std::vector<int> levels;
+		When(Method(mock, log).Using(_, And(Capture(levels), Gt(0)))).AlwaysReturn();
+
+		OrderService &i = mock.get();
+		i.log("a", 1);
+		ASSERT_THROW(i.log("b", 0), fakeit::UnexpectedMethodCallException);
+		i.log("c", 3);
+
+		ASSERT_EQUAL(2u, levels.size());
+		ASSERT_EQUAL(1, levels[0]);
+		ASSERT_EQUAL(3, levels[1]);
+	}
+
+	void copy_into_several_captures_within_And() {
+		Mock<OrderService> mock;
+		mock.DisableInvocationHistory();
+		std::vector<std::string> how;
+		std::vector<std::string> otherHow;
+		When(Method(mock, submit).Using(And(CaptureInto<Order>(OrderSink(how)), CaptureInto<Order>(OrderSink(otherHow)))))
+				.AlwaysReturn(1);
+
+		mock.get().submit(Order{1});
+
+		ASSERT_EQUAL(1u, how.size());
+		ASSERT_EQUAL(std::string("copied"), how[0]);
+		ASSERT_EQUAL(std::string("copied"), otherHow[0]);
+
+		When(Method(mock, submit).Using(And(CaptureInto<Order>(OrderSink(how)), Pred<Order>([](const Order &o) { return o.id > 0; }))))
+				.AlwaysReturn(1);
+		mock.get().submit(Order{2});
+
+		ASSERT_EQUAL(2u, how.size());
+		ASSERT_EQUAL(std::string("moved"), how[1]);
+	}
+
+	void format_Capture() {
+		Mock<OrderService> mock;
+		std::vector<std::string> messages;
+		try {
+			fakeit::Verify(Method(mock, log).Using(Capture(messages), 1)).setFileInfo("test file", 1, "test method").Exactly(Once);
+			FAIL();
+		} catch (SequenceVerificationException& e) {
+			std::string actualMsg { to_string(e) };
+			ASSERT_TRUE(actualMsg.find("Expected pattern: mock.log(Capture, 1)") != std::string::npos);
+		}
+	}
+} __ArgumentCapturing;
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <climits>
+#include <limits>
+#include <sstream>
+#include <string>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+struct Point {
+	int x;
+	int y;
+};
+
+struct Celsius {
+	double degrees;
+};
+
+namespace fakeit {
+
+	template<> struct Formatter<Point> {
+		static std::string format(const Point& p) {
+			return "Point(" + std::to_string(p.x) + "," + std::to_string(p.y) + ")";
+		}
+	};
+
+	template<> struct BufferFormatter<Celsius> {
+		static void format(std::string &out, const Celsius& c) {
+			BufferFormatter<double>::format(out, c.degrees);
+			out += "C";
+		}
+	};
+
+}
+
+using namespace fakeit;
+
+struct ArgumentFormattingTests: tpunit::TestFixture {
+	ArgumentFormattingTests()
+			: tpunit::TestFixture(
+					//
+					TEST(ArgumentFormattingTests::integers_are_formatted_like_ostream),
+					TEST(ArgumentFormattingTests::floating_points_are_formatted_like_ostream),
+					TEST(ArgumentFormattingTests::format_invocation_arguments),
+					TEST(ArgumentFormattingTests::use_Formatter_specialization),
+					TEST(ArgumentFormattingTests::use_BufferFormatter_specialization),
+					TEST(ArgumentFormattingTests::append_to_buffer)
+			) //
+	{
+	}
+
+	struct SomeInterface {
+		virtual void all(int, double, bool, char, const std::string &) = 0;
+		virtual void point(Point) = 0;
+		virtual void temperature(Celsius) = 0;
+	};
+
+	template<typename T>
+	static std::string formatWithBuffer(const T &val) {
+		std::string out;
+		BufferFormatter<T>::format(out, val);
+		return out;
+	}
+
+	template<typename T>
+	static std::string formatWithStream(const T &val) {
+		std::ostringstream out;
+		out << val;
+		return out.str();
+	}
+
+	template<typename T>
+	void assertFormattedLikeOstream(const T &val) {
+		ASSERT_EQUAL(formatWithStream(val), formatWithBuffer(val));
+	}
+
+	void integers_are_formatted_like_ostream() {
+		assertFormattedLikeOstream(0);
+		assertFormattedLikeOstream(-1);
+		assertFormattedLikeOstream(INT_MIN);
+		assertFormattedLikeOstream(INT_MAX);
+		assertFormattedLikeOstream((short) -12);
+		assertFormattedLikeOstream(std::numeric_limits<long long>::min());
+		assertFormattedLikeOstream(std::numeric_limits<unsigned long long>::max());
+		assertFormattedLikeOstream(42u);
+	}
+
+	void floating_points_are_formatted_like_ostream() {
+		assertFormattedLikeOstream(0.0);
+		assertFormattedLikeOstream(1.5);
+		assertFormattedLikeOstream(-0.1);
+		assertFormattedLikeOstream(1e20);
+		assertFormattedLikeOstream(123456789.0);
+		assertFormattedLikeOstream(3.14f);
+		assertFormattedLikeOstream(2.5L);
+		assertFormattedLikeOstream(std::numeric_limits<double>::infinity());
+	}
+
+	// the actual sequence of a failed verification lists the formatted invocations.
+	template<typename M>
+	static std::string actualSequenceOf(M &&method) {
+		try {
+			Verify(method).Never();
+		} catch (VerificationException& e) {
+			return e.what();
+		}
+		return "";
+	}
+
+	void format_invocation_arguments() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, all));
+		mock.get().all(-7, 2.5, true, 'c', "text");
+		std::string actualMsg = actualSequenceOf(Method(mock, all));
+		ASSERT_TRUE(actualMsg.find("mock.all(-7, 2.5, true, 'c', text)") != std::string::npos);
+	}
+
+	void use_Formatter_specialization() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, point));
+		mock.get().point(Point{1, 2});
+		std::string actualMsg = actualSequenceOf(Method(mock, point));
+		ASSERT_TRUE(actualMsg.find("mock.point(Point(1,2))") != std::string::npos);
+	}
+
+	void use_BufferFormatter_specialization() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, temperature));
+		mock.get().temperature(Celsius{36.6});
+		std::string actualMsg = actualSequenceOf(Method(mock, temperature));
+		ASSERT_TRUE(actualMsg.find("mock.temperature(36.6C)") != std::string::npos);
+	}
+
+	void append_to_buffer() {
+		std::string out = "args";
+		formatTuple(out, std::make_tuple(1, std::string("a"), false));
+		ASSERT_EQUAL(std::string("args(1, a, false)"), out);
+		formatTuple(out, std::tuple<>());
+		ASSERT_EQUAL(std::string("args(1, a, false)()"), out);
+	}
+
+} __ArgumentFormattingTests;
@@ -28,7 +28,10 @@ struct ArgumentMatchingTests: tpunit::TestFixture {
 					TEST(ArgumentMatchingTests::test_any_matcher), TEST(ArgumentMatchingTests::format_Lt),
 					TEST(ArgumentMatchingTests::test_any_matcher), TEST(ArgumentMatchingTests::format_Le),
 					TEST(ArgumentMatchingTests::test_any_matcher), TEST(ArgumentMatchingTests::format_Ne),
-                    TEST(ArgumentMatchingTests::mixed_matchers)
+                    TEST(ArgumentMatchingTests::mixed_matchers),
+                    TEST(ArgumentMatchingTests::custom_matcher_creator),
+                    TEST(ArgumentMatchingTests::custom_matcher_creator_derived_from_library_creator),
+                    TEST(ArgumentMatchingTests::stop_matching_at_first_mismatch)
 			) //
 	{
 	}
@@ -45,6 +48,7 @@ struct ArgumentMatchingTests: tpunit::TestFixture {
 		virtual int func(int) = 0;
 		virtual int func2(int, std::string) = 0;
         virtual int func3(const int&) = 0;
+        virtual int func4(int, int) = 0;
     };
 
 	void mixed_matchers() {
@@ -71,6 +75,101 @@ struct ArgumentMatchingTests: tpunit::TestFixture {
         ASSERT_EQUAL(6, i.func2(6, "6"));
     }
 
+	// a user defined creator, without createInlineMatcher().
+	struct CountingEvenMatcherCreator : public TypedMatcherCreator<int> {
+
+		CountingEvenMatcherCreator(int &count)
+				: _count(count) {
+		}
+
+		struct Matcher : public TypedMatcher<int> {
+			Matcher(int &count)
+					: _count(count) {
+			}
+
+			virtual bool matches(const int &actual) const override {
+				_count++;
+				return actual % 2 == 0;
+			}
+
+			virtual std::string format() const override {
+				return "even";
+			}
+
+			int &_count;
+		};
+
+		virtual TypedMatcher<int> *createMatcher() const override {
+			return new Matcher(_count);
+		}
+
+		int &_count;
+	};
+
+	void custom_matcher_creator() {
+		Mock<SomeInterface> mock;
+		int count = 0;
+
+		When(Method(mock, func2).Using(CountingEvenMatcherCreator(count), _)).Return(1);
+		When(Method(mock, func2).Using(CountingEvenMatcherCreator(count), Eq<std::string>("a"))).Return(2);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func2(2, "b"));
+		ASSERT_EQUAL(2, i.func2(4, "a"));
+		ASSERT_THROW(i.func2(3, "a"), fakeit::UnexpectedMethodCallException);
+		ASSERT_EQUAL(5, count);
+	}
+
+	// overrides only createMatcher() of a creator of the library, that also has createInlineMatcher().
+	struct EvenGtMatcherCreator : public fakeit::internal::GtMatcherCreator<int> {
+
+		EvenGtMatcherCreator(const int &expected)
+				: fakeit::internal::GtMatcherCreator<int>(expected) {
+		}
+
+		struct Matcher : public fakeit::internal::GtMatcherCreator<int>::Matcher {
+			Matcher(const int &expected)
+					: fakeit::internal::GtMatcherCreator<int>::Matcher(expected) {
+			}
+
+			virtual bool matches(const int &actual) const override {
+				return actual > this->_expected && actual % 2 == 0;
+			}
+		};
+
+		virtual TypedMatcher<int> *createMatcher() const override {
+			return new Matcher(this->_expected);
+		}
+	};
+
+	void custom_matcher_creator_derived_from_library_creator() {
+		static_assert(fakeit::has_inline_matcher<fakeit::internal::GtMatcherCreator<int>>::value,
+					  "the creators of the library match inline");
+		static_assert(!fakeit::has_inline_matcher<EvenGtMatcherCreator>::value,
+					  "a derived creator is matched through its createMatcher()");
+		Mock<SomeInterface> mock;
+
+		When(Method(mock, func).Using(EvenGtMatcherCreator(1))).AlwaysReturn(1);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func(4));
+		ASSERT_THROW(i.func(3), fakeit::UnexpectedMethodCallException);
+	}
+
+	void stop_matching_at_first_mismatch() {
+		Mock<SomeInterface> mock;
+		int count = 0;
+
+		When(Method(mock, func4).Using(Gt(10), CountingEvenMatcherCreator(count))).Return(1);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_THROW(i.func4(1, 2), fakeit::UnexpectedMethodCallException);
+		ASSERT_EQUAL(0, count);
+	}
+
 	void test_eq_matcher() {
 
 		Mock<SomeInterface> mock;
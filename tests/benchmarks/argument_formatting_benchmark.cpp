@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+// Compares formatting invocation arguments with an ostringstream per argument (print) and with BufferFormatter.
+// Build & run with: make benchmarks (from the build directory)
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct SomeInterface {
+    virtual int calc(int, long, double, bool, const std::string &) = 0;
+};
+
+// keeps the measured results alive.
+static volatile std::size_t sink;
+
+template<typename F>
+static void run(const std::string &name, unsigned int iterations, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++) {
+        f(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << name << ": " << (double) ns / iterations << " ns/op" << std::endl;
+}
+
+int main() {
+    const unsigned int iterations = 200000;
+    const std::string text = "some text";
+
+    run("ostream: print(tuple)", iterations, [&](unsigned int i) {
+        std::ostringstream out;
+        print(out, std::make_tuple((int) i, -12345678L, i * 0.25, true, text));
+        sink = out.str().size();
+    });
+
+    std::string buffer;
+    run("buffer: formatTuple(tuple)", iterations, [&](unsigned int i) {
+        buffer.clear();
+        formatTuple(buffer, std::make_tuple((int) i, -12345678L, i * 0.25, true, text));
+        sink = buffer.size();
+    });
+
+    Mock<SomeInterface> mock;
+    When(Method(mock, calc)).AlwaysReturn(0);
+    for (unsigned int i = 0; i < 1000; i++) {
+        mock.get().calc((int) i, -12345678L, i * 0.25, true, text);
+    }
+    std::unordered_set<Invocation *> invocations;
+    mock.getActualInvocations(invocations);
+
+    run("Invocation::format (1000 invocations)", iterations / 1000, [&](unsigned int) {
+        std::size_t size = 0;
+        for (auto invocation : invocations) {
+            size += invocation->format().size();
+        }
+        sink = size;
+    });
+
+    run("Invocation::formatTo (1000 invocations)", iterations / 1000, [&](unsigned int) {
+        std::size_t size = 0;
+        for (auto invocation : invocations) {
+            buffer.clear();
+            invocation->formatTo(buffer);
+            size += buffer.size();
+        }
+        sink = size;
+    });
+
+    return 0;
+}
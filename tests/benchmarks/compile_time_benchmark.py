@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Compile time benchmark of the FakeIt headers.
+# Generates synthetic test translation units, varying the number of mocked interfaces,
+# the number of methods per interface, the number of When/Verify statements and the arity of the methods.
+# For each one it measures:
+#   - frontend time (-fsyntax-only)
+#   - compile time and object size (-c -O0)
+#   - template instantiation counts, if the compiler supports -ftime-trace (Clang)
+#   - template instantiation time, if the compiler supports -ftime-report (GCC)
+# The results are written to a JSON file, so header changes can be compared for compile time regressions.
+#
+# Run from the repository root (or with: make compile_benchmarks):
+#   python3 tests/benchmarks/compile_time_benchmark.py [--output results.json]
+#   python3 tests/benchmarks/compile_time_benchmark.py --interfaces 2 --methods 10 --statements 500 --arity 2
+# The compiler is taken from the CXX environment variable (g++ by default).
+
+import argparse
+import datetime
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+fakeitPath = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..'))
+
+# (interfaces, methods per interface, When & Verify statements, arity)
+defaultScenarios = [
+    (1, 10, 10, 1),
+    (1, 10, 100, 1),
+    (1, 10, 500, 1),
+    (10, 10, 100, 1),
+    (1, 100, 100, 1),
+    (1, 10, 100, 4),
+]
+
+argumentTypes = ['int', 'const std::string&', 'double', 'long']
+argumentValues = ['1', '"a"', '1.0', '1L']
+
+
+def generateSource(interfaces, methods, statements, arity):
+    signature = ', '.join(argumentTypes[a % len(argumentTypes)] for a in range(arity))
+    arguments = ', '.join(argumentValues[a % len(argumentValues)] for a in range(arity))
+    lines = []
+    lines.append('#include <string>')
+    lines.append('#include "fakeit.hpp"')
+    lines.append('using namespace fakeit;')
+    for i in range(interfaces):
+        lines.append('struct Interface{0} {{'.format(i))
+        for m in range(methods):
+            lines.append('    virtual int method{0}({1}) = 0;'.format(m, signature))
+        lines.append('};')
+    lines.append('void test() {')
+    for i in range(interfaces):
+        lines.append('    Mock<Interface{0}> mock{0};'.format(i))
+    # the statements are spread over all the methods of all the interfaces, as is the case in a large test suite.
+    for s in range(statements):
+        i = s % interfaces
+        m = (s // interfaces) % methods
+        lines.append('    When(Method(mock{0}, method{1})).Return({2});'.format(i, m, s))
+    for i in range(interfaces):
+        lines.append('    Interface{0} &i{0} = mock{0}.get();'.format(i))
+        lines.append('    i{0}.method0({1});'.format(i, arguments))
+    for s in range(statements):
+        i = s % interfaces
+        m = (s // interfaces) % methods
+        lines.append('    Verify(Method(mock{0}, method{1})).AtLeast(0);'.format(i, m))
+    lines.append('}')
+    return '\n'.join(lines) + '\n'
+
+
+def compilerVersion(cxx):
+    output = subprocess.check_output([cxx, '--version']).decode('utf-8', 'replace')
+    return output.splitlines()[0]
+
+
+def supportsTimeTrace(version):
+    return 'clang' in version.lower()
+
+
+# a line of the -ftime-report table, the wall time is the third column.
+timeReportMatcher = re.compile(r'^\s*template instantiation\s*:\s*[\d.]+\s*\(\s*\d+%\)\s*[\d.]+\s*\(\s*\d+%\)\s*([\d.]+)')
+
+
+def instantiationSeconds(command):
+    process = subprocess.run(command + ['-ftime-report'], stderr=subprocess.PIPE, check=True)
+    for line in process.stderr.decode('utf-8', 'replace').splitlines():
+        m = timeReportMatcher.match(line)
+        if m:
+            return float(m.group(1))
+    return None
+
+
+def countInstantiations(traceFile):
+    with open(traceFile, 'r') as f:
+        trace = json.load(f)
+    counts = {'functions': 0, 'classes': 0}
+    for event in trace.get('traceEvents', []):
+        if event.get('name') == 'InstantiateFunction':
+            counts['functions'] += 1
+        elif event.get('name') == 'InstantiateClass':
+            counts['classes'] += 1
+    return counts
+
+
+def timedRun(command, repeats):
+    best = None
+    for r in range(repeats):
+        start = time.time()
+        subprocess.check_call(command)
+        elapsed = time.time() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def runScenario(cxx, includes, timeTrace, workDir, repeats, interfaces, methods, statements, arity):
+    name = 'i{0}_m{1}_s{2}_a{3}'.format(interfaces, methods, statements, arity)
+    source = os.path.join(workDir, name + '.cpp')
+    target = os.path.join(workDir, name + '.o')
+    with open(source, 'w') as f:
+        f.write(generateSource(interfaces, methods, statements, arity))
+
+    command = [cxx, '-std=c++11', '-O0']
+    for include in includes:
+        command += ['-I', include]
+
+    frontendSeconds = timedRun(command + ['-fsyntax-only', source], repeats)
+    compileSeconds = timedRun(command + ['-c', '-o', target, source], repeats)
+
+    instantiations = None
+    instantiationTime = None
+    if timeTrace:
+        subprocess.check_call(command + ['-ftime-trace', '-c', '-o', target, source])
+        instantiations = countInstantiations(os.path.splitext(target)[0] + '.json')
+    else:
+        instantiationTime = instantiationSeconds(command + ['-fsyntax-only', source])
+
+    return {
+        'name': name,
+        'interfaces': interfaces,
+        'methods': methods,
+        'statements': statements,
+        'arity': arity,
+        'frontend_seconds': round(frontendSeconds, 3),
+        'compile_seconds': round(compileSeconds, 3),
+        'object_bytes': os.path.getsize(target),
+        'instantiations': instantiations,
+        'instantiation_seconds': instantiationTime,
+    }
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='FakeIt compile time benchmark.')
+    parser.add_argument('--output', help='JSON file to write the results to.')
+    parser.add_argument('--single-header', metavar='CONFIG',
+                        help='use single_header/CONFIG/fakeit.hpp instead of the include directory.')
+    parser.add_argument('--repeats', type=int, default=3, help='the best of REPEATS runs is reported.')
+    parser.add_argument('--interfaces', type=int, help='run a single scenario with these parameters.')
+    parser.add_argument('--methods', type=int, default=10)
+    parser.add_argument('--statements', type=int, default=100)
+    parser.add_argument('--arity', type=int, default=1)
+    args = parser.parse_args(argv)
+
+    cxx = os.environ.get('CXX', 'g++')
+    version = compilerVersion(cxx)
+    timeTrace = supportsTimeTrace(version)
+
+    if args.single_header:
+        includes = [os.path.join(fakeitPath, 'single_header', args.single_header)]
+    else:
+        includes = [os.path.join(fakeitPath, 'include'), os.path.join(fakeitPath, 'config', 'standalone')]
+
+    if args.interfaces:
+        scenarios = [(args.interfaces, args.methods, args.statements, args.arity)]
+    else:
+        scenarios = defaultScenarios
+
+    print('{0:<20} {1:>10} {2:>10} {3:>14} {4:>16}'.format(
+        'scenario', 'frontend', 'compile', 'object bytes', 'instantiations' if timeTrace else 'instantiation'))
+    results = []
+    workDir = tempfile.mkdtemp(prefix='fakeit_compile_time_')
+    try:
+        for scenario in scenarios:
+            result = runScenario(cxx, includes, timeTrace, workDir, args.repeats, *scenario)
+            results.append(result)
+            instantiations = result['instantiations']
+            if instantiations:
+                instantiationsColumn = instantiations['functions'] + instantiations['classes']
+            elif result['instantiation_seconds'] is not None:
+                instantiationsColumn = '{0:.2f}'.format(result['instantiation_seconds'])
+            else:
+                instantiationsColumn = 'n/a'
+            print('{0:<20} {1:>10.2f} {2:>10.2f} {3:>14} {4:>16}'.format(
+                result['name'], result['frontend_seconds'], result['compile_seconds'], result['object_bytes'],
+                instantiationsColumn))
+    finally:
+        shutil.rmtree(workDir)
+
+    if args.output:
+        report = {
+            'date': datetime.datetime.now().isoformat(),
+            'compiler': version,
+            'headers': args.single_header and 'single_header/' + args.single_header or 'include',
+            'results': results,
+        }
+        with open(args.output, 'w') as f:
+            json.dump(report, f, indent=2)
+        print('results written to ' + args.output)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+// Measures the cost of the Method(mock, method) expression and of the calls it makes into VTUtils.
+// Build & run with: make benchmarks (from the build directory)
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct SomeInterface {
+    virtual int func(int) = 0;
+
+    virtual void proc(int) = 0;
+
+    virtual int calc(int, const std::string &) = 0;
+};
+
+// keeps the measured results alive.
+static volatile unsigned int sink;
+
+template<typename F>
+static void run(const std::string &name, unsigned int iterations, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++) {
+        f();
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << name << ": " << (double) ns / iterations << " ns/op" << std::endl;
+}
+
+int main() {
+    const unsigned int iterations = 200000;
+
+    Mock<SomeInterface> mock;
+    When(Method(mock, func)).AlwaysReturn(1);
+    for (int i = 0; i < 10; i++) {
+        mock.get().func(i);
+    }
+
+    run("VTUtils::getVTSize", iterations, [] {
+        sink = VTUtils::getVTSize<SomeInterface>();
+    });
+
+    run("VTUtils::getOffset", iterations, [] {
+        sink = VTUtils::getOffset(&SomeInterface::calc);
+    });
+
+    run("Method(mock, func)", iterations, [&] {
+        Method(mock, func);
+    });
+
+    run("Verify(Method(mock, func))", iterations / 10, [&] {
+        Verify(Method(mock, func)).Exactly(10);
+    });
+
+    return 0;
+}
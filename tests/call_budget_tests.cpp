@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct CallBudgetTests: tpunit::TestFixture {
+	CallBudgetTests()
+			: tpunit::TestFixture(
+					//
+					TEST(CallBudgetTests::calls_within_budget_do_not_fail),
+					TEST(CallBudgetTests::fail_on_the_call_over_budget),
+					TEST(CallBudgetTests::report_the_call_over_budget),
+					TEST(CallBudgetTests::count_only_matching_calls),
+					TEST(CallBudgetTests::count_only_calls_made_while_in_scope),
+					TEST(CallBudgetTests::fail_on_constant_stub_without_history),
+					TEST(CallBudgetTests::negative_budget_is_invalid)
+			) //
+	{
+	}
+
+	std::string formatLineNumner(std::string file, int num) {
+#ifndef __GNUG__
+		return file + std::string("(") + std::to_string(num) + std::string(")");
+#else
+		return file + std::string(":") + std::to_string(num);
+#endif
+	}
+
+	template <typename T> std::string to_string(T& val) {
+		std::stringstream stream;
+		stream << val;
+		return stream.str();
+	}
+
+	struct SomeInterface {
+		virtual int func(int) = 0;
+		virtual void proc(int) = 0;
+	};
+
+	void calls_within_budget_do_not_fail() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func), Method(mock, proc));
+		SomeInterface &i = mock.get();
+
+		CallBudget budget(Method(mock, func), 2);
+		i.func(1);
+		i.proc(1);
+		i.func(2);
+		i.proc(2);
+		ASSERT_EQUAL(2, budget.calls());
+		ASSERT_EQUAL(0, budget.remaining());
+	}
+
+	void fail_on_the_call_over_budget() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		SomeInterface &i = mock.get();
+
+		CallBudget budget(Method(mock, func), 1);
+		i.func(1);
+		ASSERT_THROW(i.func(2), fakeit::SequenceVerificationException);
+		ASSERT_THROW(i.func(3), fakeit::SequenceVerificationException);
+		ASSERT_EQUAL(3, budget.calls());
+	}
+
+	void report_the_call_over_budget() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		SomeInterface &i = mock.get();
+
+		CallBudget budget(Method(mock, func), 2);
+		budget.setFileInfo("test file", 1, "test method");
+		i.func(1);
+		i.func(2);
+		try {
+			i.func(3);
+			FAIL();
+		}
+		catch (SequenceVerificationException& e) {
+			std::string expectedMsg{ formatLineNumner("test file", 1) };
+			expectedMsg += ": Verification error\n";
+			expectedMsg += "Expected pattern: mock.func( Any arguments )\n";
+			expectedMsg += "Expected matches: at most 2\n";
+			expectedMsg += "Actual matches  : more than 2\n";
+			expectedMsg += "Actual sequence : total of 1 actual invocations:\n";
+			expectedMsg += "  mock.func(3)";
+			std::string actualMsg{ to_string(e) };
+			ASSERT_EQUAL(expectedMsg, actualMsg);
+		}
+	}
+
+	void count_only_matching_calls() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		SomeInterface &i = mock.get();
+
+		CallBudget budget(Method(mock, func).Using(1), 1);
+		i.func(1);
+		i.func(2);
+		i.func(2);
+		ASSERT_EQUAL(1, budget.calls());
+		ASSERT_THROW(i.func(1), fakeit::SequenceVerificationException);
+	}
+
+	void count_only_calls_made_while_in_scope() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		SomeInterface &i = mock.get();
+		i.func(1);
+		i.func(1);
+		{
+			CallBudget budget(Method(mock, func), 1);
+			i.func(1);
+			ASSERT_EQUAL(1, budget.calls());
+		}
+		i.func(1);
+		Verify(Method(mock, func)).Exactly(4);
+	}
+
+	void fail_on_constant_stub_without_history() {
+		Mock<SomeInterface> mock;
+		mock.DisableInvocationHistory();
+		When(Method(mock, func)).AlwaysReturn(1);
+		SomeInterface &i = mock.get();
+
+		CallBudget budget(Method(mock, func), 2);
+		ASSERT_EQUAL(1, i.func(1));
+		ASSERT_EQUAL(1, i.func(2));
+		ASSERT_THROW(i.func(3), fakeit::SequenceVerificationException);
+		ASSERT_EQUAL(3, budget.calls());
+	}
+
+	void negative_budget_is_invalid() {
+		Mock<SomeInterface> mock;
+		ASSERT_THROW(CallBudget(Method(mock, func), -1), std::invalid_argument);
+		ASSERT_FALSE(Fakeit.hasInvocationEventHandlers());
+	}
+
+} __CallBudgetTests;
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <cstdio>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+#include "fakeit/CallRecording.hpp"
+
+using namespace fakeit;
+
+struct Location {
+	int x;
+	std::string label;
+};
+
+namespace fakeit {
+
+	template<>
+	struct Codec<Location> {
+		static void encode(std::string &out, const Location &val) {
+			Codec<int>::encode(out, val.x);
+			Codec<std::string>::encode(out, val.label);
+		}
+
+		static Location decode(const char *&data, const char *end) {
+			int x = Codec<int>::decode(data, end);
+			return Location{x, Codec<std::string>::decode(data, end)};
+		}
+	};
+
+}
+
+struct CallRecordingTests: tpunit::TestFixture {
+	CallRecordingTests()
+			: tpunit::TestFixture(
+					//
+					TEST(CallRecordingTests::replay_recorded_calls_without_the_real_object),
+					TEST(CallRecordingTests::replay_same_arguments_in_recorded_order),
+					TEST(CallRecordingTests::unrecorded_arguments_are_unmatched),
+					TEST(CallRecordingTests::record_with_user_codec),
+					TEST(CallRecordingTests::record_enums_and_floating_point),
+					TEST(CallRecordingTests::replay_const_results),
+					TEST(CallRecordingTests::record_several_methods),
+					TEST(CallRecordingTests::calls_that_throw_are_not_recorded),
+					TEST(CallRecordingTests::unknown_key_is_invalid),
+					TEST(CallRecordingTests::reject_a_file_that_is_not_a_recording)
+			) //
+	{
+	}
+
+	enum class Unit {
+		Meter, Foot
+	};
+
+	struct Backend {
+		Backend() : calls(0) {
+		}
+
+		virtual int query(int id, const std::string &name) {
+			calls++;
+			return id * 10 + (int) name.size();
+		}
+
+		virtual Location locate(const std::string &name) {
+			calls++;
+			return Location{(int) name.size(), name + "!"};
+		}
+
+		virtual double convert(Unit unit, double value) {
+			calls++;
+			return unit == Unit::Foot ? value * 0.3048 : value;
+		}
+
+		virtual const std::string describe(int id) {
+			calls++;
+			return std::string("item ") + std::to_string(id);
+		}
+
+		virtual int next(int step) {
+			return calls += step;
+		}
+
+		virtual void store(int id) {
+			calls++;
+			if (id < 0)
+				throw std::invalid_argument("negative id");
+		}
+
+		int calls;
+	};
+
+	static const char *path() {
+		return "call_recording_tests.calls";
+	}
+
+	static void teardown() {
+		std::remove(path());
+	}
+
+	class finally {
+	private:
+		std::function<void()> finallyClause;
+		finally(const finally &);
+		finally& operator=(const finally &);
+	public:
+		explicit finally(std::function<void()> f)
+				: finallyClause(f) {
+		}
+
+		~finally() {
+			finallyClause();
+		}
+	};
+
+	void replay_recorded_calls_without_the_real_object() {
+		finally onExit(teardown);
+		Backend backend;
+		{
+			CallRecorder recorder(path());
+			Mock<Backend> spy(backend);
+			recorder.Record("query", Method(spy, query));
+			ASSERT_EQUAL(11, spy.get().query(1, "a"));
+			ASSERT_EQUAL(23, spy.get().query(2, "abc"));
+			ASSERT_EQUAL(2ull, recorder.calls());
+		}
+		ASSERT_EQUAL(2, backend.calls);
+
+		CallPlayer player(path());
+		ASSERT_EQUAL(2ull, player.calls());
+		Mock<Backend> mock;
+		player.Replay("query", Method(mock, query));
+		ASSERT_EQUAL(23, mock.get().query(2, "abc"));
+		ASSERT_EQUAL(11, mock.get().query(1, "a"));
+		ASSERT_EQUAL(2, backend.calls);
+		Verify(Method(mock, query)).Twice();
+	}
+
+	void replay_same_arguments_in_recorded_order() {
+		finally onExit(teardown);
+		Backend backend;
+		{
+			CallRecorder recorder(path());
+			Mock<Backend> spy(backend);
+			recorder.Record("next", Method(spy, next));
+			ASSERT_EQUAL(1, spy.get().next(1));
+			ASSERT_EQUAL(2, spy.get().next(1));
+		}
+
+		CallPlayer player(path());
+		Mock<Backend> mock;
+		player.Replay("next", Method(mock, next));
+		ASSERT_EQUAL(1, mock.get().next(1));
+		ASSERT_EQUAL(2, mock.get().next(1));
+		ASSERT_EQUAL(2, mock.get().next(1));
+		player.rewind();
+		ASSERT_EQUAL(1, mock.get().next(1));
+	}
+
+	void unrecorded_arguments_are_unmatched() {
+		finally onExit(teardown);
+		Backend backend;
+		{
+			CallRecorder recorder(path());
+			Mock<Backend> spy(backend);
+			recorder.Record("query", Method(spy, query));
+			spy.get().query(1, "a");
+		}
+
+		CallPlayer player(path());
+		Mock<Backend> mock;
+		player.Replay("query", Method(mock, query));
+		ASSERT_THROW(mock.get().query(1, "b"), fakeit::UnexpectedMethodCallException);
+		ASSERT_EQUAL(11, mock.get().query(1, "a"));
+	}
+
+	void record_with_user_codec() {
+		finally onExit(teardown);
+		Backend backend;
+		{
+			CallRecorder recorder(path());
+			Mock<Backend> spy(backend);
+			recorder.Record("locate", Method(spy, locate));
+			spy.get().locate("home");
+		}
+
+		CallPlayer player(path());
+		Mock<Backend> mock;
+		player.Replay("locate", Method(mock, locate));
+		Location p = mock.get().locate("home");
+		ASSERT_EQUAL(4, p.x);
+		ASSERT_EQUAL(std::string("home!"), p.label);
+	}
+
+	void record_enums_and_floating_point() {
+		finally onExit(teardown);
+		Backend backend;
+		{
+			CallRecorder recorder(path());
+			Mock<Backend> spy(backend);
+			recorder.Record("convert", Method(spy, convert));
+			spy.get().convert(Unit::Foot, 10);
+			spy.get().convert(Unit::Meter, 10);
+		}
+
+		CallPlayer player(path());
+		Mock<Backend> mock;
+		player.Replay("convert", Method(mock, convert));
+		ASSERT_EQUAL(10 * 0.3048, mock.get().convert(Unit::Foot, 10));
+		ASSERT_EQUAL(10.0, mock.get().convert(Unit::Meter, 10));
+		ASSERT_THROW(mock.get().convert(Unit::Meter, 11), fakeit::UnexpectedMethodCallException);
+	}
+
+	void replay_const_results() {
+		finally onExit(teardown);
+		Backend backend;
+		{
+			CallRecorder recorder(path());
+			Mock<Backend> spy(backend);
+			recorder.Record("describe", Method(spy, describe));
+			spy.get().describe(7);
+		}
+
+		CallPlayer player(path());
+		Mock<Backend> mock;
+		player.Replay("describe", Method(mock, describe));
+		ASSERT_EQUAL(std::string("item 7"), mock.get().describe(7));
+	}
+
+	void record_several_methods() {
+		finally onExit(teardown);
+		Backend backend;
+		{
+			CallRecorder recorder(path());
+			Mock<Backend> spy(backend);
+			recorder.Record("query", Method(spy, query));
+			recorder.Record("store", Method(spy, store));
+			spy.get().store(5);
+			spy.get().query(5, "e");
+		}
+		ASSERT_EQUAL(2, backend.calls);
+
+		CallPlayer player(path());
+		Mock<Backend> mock;
+		player.Replay("query", Method(mock, query));
+		player.Replay("store", Method(mock, store));
+		mock.get().store(5);
+		ASSERT_THROW(mock.get().store(6), fakeit::UnexpectedMethodCallException);
+		ASSERT_EQUAL(51, mock.get().query(5, "e"));
+		ASSERT_EQUAL(2, backend.calls);
+	}
+
+	void calls_that_throw_are_not_recorded() {
+		finally onExit(teardown);
+		Backend backend;
+		CallRecorder recorder(path());
+		Mock<Backend> spy(backend);
+		recorder.Record("store", Method(spy, store));
+		ASSERT_THROW(spy.get().store(-1), std::invalid_argument);
+		spy.get().store(1);
+		ASSERT_EQUAL(1ull, recorder.calls());
+		recorder.close();
+	}
+
+	void unknown_key_is_invalid() {
+		finally onExit(teardown);
+		{
+			CallRecorder recorder(path());
+		}
+		CallPlayer player(path());
+		Mock<Backend> mock;
+		ASSERT_THROW(player.Replay("query", Method(mock, query)), std::invalid_argument);
+	}
+
+	void reject_a_file_that_is_not_a_recording() {
+		finally onExit(teardown);
+		std::FILE *file = std::fopen(path(), "wb");
+		std::fputs("not a recording", file);
+		std::fclose(file);
+		ASSERT_THROW(CallPlayer player(path()), std::runtime_error);
+		ASSERT_THROW(CallPlayer player("no such file.calls"), std::runtime_error);
+	}
+
+} __CallRecordingTests;
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <stdexcept>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct CheckVerificationTests: tpunit::TestFixture {
+	CheckVerificationTests()
+			: tpunit::TestFixture(
+					//
+					TEST(CheckVerificationTests::exact_check_result),
+					TEST(CheckVerificationTests::failed_check_does_not_throw),
+					TEST(CheckVerificationTests::at_least_check_result),
+					TEST(CheckVerificationTests::range_check_stops_counting_over_the_limit),
+					TEST(CheckVerificationTests::check_in_boolean_context),
+					TEST(CheckVerificationTests::check_sequence),
+					TEST(CheckVerificationTests::successful_check_marks_invocations_as_verified),
+					TEST(CheckVerificationTests::failed_check_does_not_mark_invocations_as_verified),
+					TEST(CheckVerificationTests::negative_count_is_invalid)
+			) //
+	{
+	}
+
+	struct SomeInterface {
+		virtual int func(int) = 0;
+		virtual void proc(int) = 0;
+	};
+
+	void exact_check_result() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func), Method(mock, proc));
+		SomeInterface &i = mock.get();
+		i.func(1);
+		i.func(2);
+		i.func(1);
+
+		VerificationResult r = Check(Method(mock, func)).Exactly(3);
+		ASSERT_TRUE(r.ok());
+		ASSERT_EQUAL(3, r.expectedCount());
+		ASSERT_EQUAL(3, r.actualCount());
+		ASSERT_TRUE(VerificationType::Exact == r.verificationType());
+
+		ASSERT_EQUAL(2, Check(Method(mock, func).Using(1)).Twice().actualCount());
+		ASSERT_TRUE(Check(Method(mock, proc)).Never().ok());
+	}
+
+	void failed_check_does_not_throw() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		SomeInterface &i = mock.get();
+		i.func(1);
+		i.func(1);
+
+		VerificationResult r = Check(Method(mock, func)).Exactly(3);
+		ASSERT_FALSE(r.ok());
+		ASSERT_FALSE(r);
+		ASSERT_EQUAL(3, r.expectedCount());
+		ASSERT_EQUAL(2, r.actualCount());
+		ASSERT_FALSE(Check(Method(mock, func)).Once());
+		ASSERT_FALSE(Check(Method(mock, proc)).AtLeastOnce());
+	}
+
+	void at_least_check_result() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		SomeInterface &i = mock.get();
+		i.func(1);
+		i.func(1);
+
+		VerificationResult r = Check(Method(mock, func)).AtLeast(Times<2>());
+		ASSERT_TRUE(r.ok());
+		ASSERT_TRUE(VerificationType::AtLeast == r.verificationType());
+		ASSERT_EQUAL(2, r.expectedCount());
+		ASSERT_EQUAL(2, r.actualCount());
+
+		r = Check(Method(mock, func)).AtLeast(3);
+		ASSERT_FALSE(r.ok());
+		ASSERT_EQUAL(3, r.expectedCount());
+		ASSERT_EQUAL(2, r.actualCount());
+	}
+
+	void range_check_stops_counting_over_the_limit() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		SomeInterface &i = mock.get();
+		for (int n = 0; n < 10; n++)
+			i.func(n);
+
+		VerificationResult r = Check(Method(mock, func)).AtMost(3);
+		ASSERT_FALSE(r.ok());
+		ASSERT_TRUE(VerificationType::AtMost == r.verificationType());
+		ASSERT_EQUAL(3, r.expectedMaxCount());
+		ASSERT_EQUAL(4, r.actualCount());
+
+		r = Check(Method(mock, func)).Between(2, 12);
+		ASSERT_TRUE(r.ok());
+		ASSERT_EQUAL(2, r.expectedCount());
+		ASSERT_EQUAL(12, r.expectedMaxCount());
+		ASSERT_EQUAL(10, r.actualCount());
+		ASSERT_FALSE(Check(Method(mock, func)).Between(11, 12));
+		ASSERT_THROW(Check(Method(mock, func)).Between(2, 1), std::invalid_argument);
+	}
+
+	void check_in_boolean_context() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func), Method(mock, proc));
+		mock.get().func(1);
+
+		ASSERT_TRUE(Check(Method(mock, func)));
+		ASSERT_FALSE(Check(Method(mock, proc)));
+		ASSERT_TRUE(!Check(Method(mock, proc)));
+		int passed = 0;
+		for (int n = 0; n < 1000; n++) {
+			if (Check(Method(mock, func).Using(n % 2)).Once())
+				passed++;
+		}
+		ASSERT_EQUAL(500, passed);
+	}
+
+	void check_sequence() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func), Method(mock, proc));
+		SomeInterface &i = mock.get();
+		i.func(1);
+		i.proc(1);
+		i.func(1);
+		i.proc(1);
+
+		ASSERT_EQUAL(2, Check(Method(mock, func) + Method(mock, proc)).Twice().actualCount());
+		ASSERT_TRUE(Check(Method(mock, func) * 2).Never());
+		ASSERT_FALSE(Check(Method(mock, proc) + Method(mock, proc)).AtLeastOnce());
+	}
+
+	void successful_check_marks_invocations_as_verified() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		mock.get().func(1);
+
+		ASSERT_TRUE(Check(Method(mock, func)).Once());
+		VerifyNoOtherInvocations(mock);
+	}
+
+	void failed_check_does_not_mark_invocations_as_verified() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		mock.get().func(1);
+
+		ASSERT_FALSE(Check(Method(mock, func)).Twice());
+		ASSERT_THROW(VerifyNoOtherInvocations(mock), fakeit::VerificationException);
+	}
+
+	void negative_count_is_invalid() {
+		Mock<SomeInterface> mock;
+		ASSERT_THROW(Check(Method(mock, func)).Exactly(-1), std::invalid_argument);
+		ASSERT_THROW(Check(Method(mock, func)).AtLeast(-1), std::invalid_argument);
+	}
+
+} __CheckVerificationTests;
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+#include "fakeit/ChromeTraceWriter.hpp"
+
+using namespace fakeit;
+
+struct ChromeTraceTests: tpunit::TestFixture {
+	ChromeTraceTests()
+			: tpunit::TestFixture(
+					//
+					TEST(ChromeTraceTests::write_a_complete_event_per_call),
+					TEST(ChromeTraceTests::write_nested_calls_inner_first),
+					TEST(ChromeTraceTests::write_calls_that_throw),
+					TEST(ChromeTraceTests::stream_events_while_running),
+					TEST(ChromeTraceTests::empty_trace_is_valid),
+					TEST(ChromeTraceTests::stop_tracing_when_closed_or_destroyed)
+			) //
+	{
+	}
+
+	struct SomeInterface {
+		virtual int func(int) = 0;
+		virtual void proc() = 0;
+	};
+
+	static const char *path() {
+		return "chrome_trace_tests.json";
+	}
+
+	static std::string readTrace() {
+		std::ifstream in(path(), std::ios::binary);
+		std::stringstream content;
+		content << in.rdbuf();
+		return content.str();
+	}
+
+	static int occurrences(const std::string &text, const std::string &what) {
+		int count = 0;
+		for (std::size_t pos = text.find(what); pos != std::string::npos; pos = text.find(what, pos + 1))
+			count++;
+		return count;
+	}
+
+	static void teardown() {
+		Fakeit.clearInvocationEventHandlers();
+		std::remove(path());
+	}
+
+	class finally {
+	private:
+		std::function<void()> finallyClause;
+		finally(const finally &);
+		finally& operator=(const finally &);
+	public:
+		explicit finally(std::function<void()> f)
+				: finallyClause(f) {
+		}
+
+		~finally() {
+			finallyClause();
+		}
+	};
+
+	void write_a_complete_event_per_call() {
+		finally onExit(teardown);
+		{
+			ChromeTraceWriter trace(path());
+			Mock<SomeInterface> mock;
+			Fake(Method(mock, func), Method(mock, proc));
+			SomeInterface &i = mock.get();
+			i.func(1);
+			i.proc();
+			i.func(2);
+			ASSERT_EQUAL(3ull, trace.events());
+		}
+		std::string trace = readTrace();
+		ASSERT_EQUAL(0u, trace.find("[\n{\"name\":\"mock.func\",\"cat\":\"fakeit\",\"ph\":\"X\",\"ts\":"));
+		ASSERT_EQUAL(3, occurrences(trace, "\"ph\":\"X\""));
+		ASSERT_EQUAL(2, occurrences(trace, "\"name\":\"mock.func\""));
+		ASSERT_EQUAL(1, occurrences(trace, "\"name\":\"mock.proc\""));
+		ASSERT_EQUAL(3, occurrences(trace, "\"pid\":1,\"tid\":1,\"args\":{\"ordinal\":"));
+		ASSERT_EQUAL(trace.size() - 4, trace.rfind("}\n]\n"));
+	}
+
+	void write_nested_calls_inner_first() {
+		finally onExit(teardown);
+		{
+			ChromeTraceWriter trace(path());
+			Mock<SomeInterface> mock;
+			SomeInterface &i = mock.get();
+			Fake(Method(mock, proc));
+			When(Method(mock, func)).AlwaysDo([&](int) { i.proc(); return 1; });
+			i.func(1);
+		}
+		std::string trace = readTrace();
+		ASSERT_TRUE(trace.find("mock.proc") < trace.find("mock.func"));
+	}
+
+	void write_calls_that_throw() {
+		finally onExit(teardown);
+		{
+			ChromeTraceWriter trace(path());
+			Mock<SomeInterface> mock;
+			When(Method(mock, func).Using(1)).AlwaysReturn(1);
+			ASSERT_THROW(mock.get().func(2), UnexpectedMethodCallException);
+			ASSERT_EQUAL(1ull, trace.events());
+		}
+		ASSERT_EQUAL(1, occurrences(readTrace(), "\"name\":\"mock.func\""));
+	}
+
+	void stream_events_while_running() {
+		finally onExit(teardown);
+		ChromeTraceWriter trace(path(), 512);
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, proc));
+		for (int n = 0; n < 100; n++)
+			mock.get().proc();
+		ASSERT_TRUE(readTrace().size() > 512);
+		trace.flush();
+		ASSERT_EQUAL(100, occurrences(readTrace(), "\"name\":\"mock.proc\""));
+		trace.close();
+	}
+
+	void empty_trace_is_valid() {
+		finally onExit(teardown);
+		{
+			ChromeTraceWriter trace(path());
+		}
+		ASSERT_EQUAL(std::string("[\n]\n"), readTrace());
+	}
+
+	void stop_tracing_when_closed_or_destroyed() {
+		finally onExit(teardown);
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, proc));
+		{
+			ChromeTraceWriter trace(path());
+			ASSERT_TRUE(Fakeit.hasInvocationEventHandlers());
+			trace.close();
+			ASSERT_FALSE(Fakeit.hasInvocationEventHandlers());
+		}
+		{
+			ChromeTraceWriter trace(path());
+			mock.get().proc();
+		}
+		ASSERT_FALSE(Fakeit.hasInvocationEventHandlers());
+		mock.get().proc();
+		ASSERT_EQUAL(1, occurrences(readTrace(), "\"name\":\"mock.proc\""));
+	}
+
+} __ChromeTraceTests;
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <string>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct CompositeArgumentMatchingTests: tpunit::TestFixture {
+	CompositeArgumentMatchingTests()
+			: tpunit::TestFixture(
+					//
+					TEST(CompositeArgumentMatchingTests::test_and_matcher),
+					TEST(CompositeArgumentMatchingTests::test_or_matcher),
+					TEST(CompositeArgumentMatchingTests::test_not_matcher),
+					TEST(CompositeArgumentMatchingTests::test_pred_matcher),
+					TEST(CompositeArgumentMatchingTests::format_composite_matchers),
+					TEST(CompositeArgumentMatchingTests::composite_matcher_evaluates_decisive_child_first)
+			) //
+	{
+	}
+
+	struct SomeInterface {
+		virtual int func(int) = 0;
+		virtual int func2(int, std::string) = 0;
+	};
+
+	void test_and_matcher() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, func).Using(And(Gt(0), Lt(10)))).AlwaysReturn(1);
+		When(Method(mock, func).Using(And(Ge(10), Le(20), Ne(15)))).AlwaysReturn(2);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func(5));
+		ASSERT_EQUAL(2, i.func(10));
+		ASSERT_THROW(i.func(15), fakeit::UnexpectedMethodCallException);
+		ASSERT_THROW(i.func(0), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_or_matcher() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, func).Using(Or(Lt(0), Gt(10), Eq(5)))).AlwaysReturn(1);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func(-1));
+		ASSERT_EQUAL(1, i.func(11));
+		ASSERT_EQUAL(1, i.func(5));
+		ASSERT_THROW(i.func(1), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_not_matcher() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, func2).Using(Not(Eq(1)), Not(Eq<std::string>("a")))).AlwaysReturn(1);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func2(2, "b"));
+		ASSERT_THROW(i.func2(1, "b"), fakeit::UnexpectedMethodCallException);
+		ASSERT_THROW(i.func2(2, "a"), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_pred_matcher() {
+		Mock<SomeInterface> mock;
+		auto isEven = [](const int &a) { return a % 2 == 0; };
+		When(Method(mock, func).Using(Pred<int>(isEven))).AlwaysReturn(2);
+		When(Method(mock, func).Using(And(Gt(0), Pred<int>(isEven)))).AlwaysReturn(1);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func(4));
+		ASSERT_EQUAL(2, i.func(-4));
+		ASSERT_THROW(i.func(3), fakeit::UnexpectedMethodCallException);
+	}
+
+	void format_composite_matchers() {
+		Mock<SomeInterface> mock;
+		try {
+			fakeit::Verify(Method(mock, func).Using(Or(And(Gt(0), Lt(10)), Not(Eq(20)), Pred<int>([](const int &) { return true; }))))
+					.setFileInfo("test file", 1, "test method").Exactly(Once);
+			FAIL();
+		} catch (SequenceVerificationException& e) {
+			std::string actualMsg { to_string(e) };
+			ASSERT_TRUE(actualMsg.find("Expected pattern: mock.func(Or(And(>0, <10), Not(20), Pred))") != std::string::npos);
+		}
+	}
+
+	void composite_matcher_evaluates_decisive_child_first() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		SomeInterface &i = mock.get();
+		for (int n = 0; n < 1000; n++) {
+			i.func(n);
+		}
+
+		int neverDecisive = 0;
+		auto countingTrue = [&neverDecisive](const int &) {
+			neverDecisive++;
+			return true;
+		};
+		// the first child never decides the result, the second always does.
+		Verify(Method(mock, func).Using(And(Pred<int>(countingTrue), Lt(0)))).Never();
+		ASSERT_TRUE(neverDecisive < 1000);
+	}
+} __CompositeArgumentMatching;
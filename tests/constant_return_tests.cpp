@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <string>
+
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct ConstantReturnTests : tpunit::TestFixture {
+
+    ConstantReturnTests() :
+            tpunit::TestFixture(
+                    //
+                    TEST(ConstantReturnTests::always_return_is_returned_directly_when_history_is_disabled),
+                    TEST(ConstantReturnTests::fake_is_returned_directly_when_history_is_disabled),
+                    TEST(ConstantReturnTests::class_and_reference_values_are_returned_directly),
+                    TEST(ConstantReturnTests::method_is_dispatched_when_history_is_enabled),
+                    TEST(ConstantReturnTests::method_is_dispatched_again_when_history_is_enabled),
+                    TEST(ConstantReturnTests::method_is_dispatched_when_stubbed_with_arguments),
+                    TEST(ConstantReturnTests::method_is_dispatched_when_stubbed_with_sequence),
+                    TEST(ConstantReturnTests::last_always_return_wins),
+                    TEST(ConstantReturnTests::stubbing_a_method_leaves_the_other_methods_returned_directly),
+                    TEST(ConstantReturnTests::reset_restores_unmocked_methods)
+                    //
+            ) {
+    }
+
+    struct SomeInterface {
+        virtual int func(int) = 0;
+
+        virtual void proc(int) = 0;
+
+        virtual std::string str() = 0;
+
+        virtual int &ref() = 0;
+    };
+
+    template<typename R, typename ... arglist>
+    static void *getVirtualTableEntry(SomeInterface &i, R(SomeInterface::*vMethod)(arglist...)) {
+        void **vt = *reinterpret_cast<void ***>(&i);
+        return vt[VTUtils::getOffset(vMethod)];
+    }
+
+    void always_return_is_returned_directly_when_history_is_disabled() {
+        Mock<SomeInterface> mock;
+        When(Method(mock, func)).AlwaysReturn(1);
+        void *dispatcher = getVirtualTableEntry(mock.get(), &SomeInterface::func);
+
+        mock.DisableInvocationHistory();
+
+        ASSERT_NOT_EQUAL(dispatcher, getVirtualTableEntry(mock.get(), &SomeInterface::func));
+        ASSERT_EQUAL(1, mock.get().func(1));
+        ASSERT_EQUAL(1, mock.get().func(2));
+    }
+
+    void fake_is_returned_directly_when_history_is_disabled() {
+        Mock<SomeInterface> mock;
+        Fake(Method(mock, func), Method(mock, proc));
+        void *funcDispatcher = getVirtualTableEntry(mock.get(), &SomeInterface::func);
+        void *procDispatcher = getVirtualTableEntry(mock.get(), &SomeInterface::proc);
+
+        mock.DisableInvocationHistory();
+
+        ASSERT_NOT_EQUAL(funcDispatcher, getVirtualTableEntry(mock.get(), &SomeInterface::func));
+        ASSERT_NOT_EQUAL(procDispatcher, getVirtualTableEntry(mock.get(), &SomeInterface::proc));
+        ASSERT_EQUAL(0, mock.get().func(1));
+        mock.get().proc(1);
+    }
+
+    void class_and_reference_values_are_returned_directly() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        When(Method(mock, str)).AlwaysReturn("value");
+        Fake(Method(mock, ref));
+
+        ASSERT_EQUAL(std::string("value"), mock.get().str());
+        ASSERT_EQUAL(0, mock.get().ref());
+        ASSERT_EQUAL(&mock.get().ref(), &mock.get().ref());
+    }
+
+    void method_is_dispatched_when_history_is_enabled() {
+        Mock<SomeInterface> mock;
+        When(Method(mock, func)).AlwaysReturn(1);
+
+        ASSERT_EQUAL(1, mock.get().func(1));
+        Verify(Method(mock, func)).Once();
+    }
+
+    void method_is_dispatched_again_when_history_is_enabled() {
+        Mock<SomeInterface> mock;
+        When(Method(mock, func)).AlwaysReturn(1);
+        void *dispatcher = getVirtualTableEntry(mock.get(), &SomeInterface::func);
+        mock.DisableInvocationHistory();
+        mock.get().func(1);
+
+        mock.EnableInvocationHistory();
+
+        ASSERT_EQUAL(dispatcher, getVirtualTableEntry(mock.get(), &SomeInterface::func));
+        ASSERT_EQUAL(1, mock.get().func(2));
+        Verify(Method(mock, func).Using(2)).Once();
+        Verify(Method(mock, func)).Once();
+    }
+
+    void method_is_dispatched_when_stubbed_with_arguments() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        When(Method(mock, func)).AlwaysReturn(1);
+        When(Method(mock, func).Using(2)).AlwaysReturn(2);
+
+        ASSERT_EQUAL(1, mock.get().func(1));
+        ASSERT_EQUAL(2, mock.get().func(2));
+
+        When(Method(mock, func)).AlwaysReturn(3);
+        ASSERT_EQUAL(3, mock.get().func(2));
+    }
+
+    void method_is_dispatched_when_stubbed_with_sequence() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        When(Method(mock, func)).Return(1).AlwaysReturn(2);
+
+        ASSERT_EQUAL(1, mock.get().func(1));
+        ASSERT_EQUAL(2, mock.get().func(1));
+        ASSERT_EQUAL(2, mock.get().func(1));
+    }
+
+    void last_always_return_wins() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        When(Method(mock, func)).AlwaysReturn(1);
+        ASSERT_EQUAL(1, mock.get().func(1));
+
+        When(Method(mock, func)).AlwaysReturn(2);
+        ASSERT_EQUAL(2, mock.get().func(1));
+    }
+
+    void stubbing_a_method_leaves_the_other_methods_returned_directly() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        When(Method(mock, func)).AlwaysReturn(1);
+        When(Method(mock, str)).AlwaysReturn("a");
+        void *funcConstant = getVirtualTableEntry(mock.get(), &SomeInterface::func);
+        void *strConstant = getVirtualTableEntry(mock.get(), &SomeInterface::str);
+
+        When(Method(mock, func).Using(2)).Return(2);
+
+        ASSERT_NOT_EQUAL(funcConstant, getVirtualTableEntry(mock.get(), &SomeInterface::func));
+        ASSERT_EQUAL(strConstant, getVirtualTableEntry(mock.get(), &SomeInterface::str));
+        ASSERT_EQUAL(2, mock.get().func(2));
+        ASSERT_EQUAL(1, mock.get().func(1));
+        ASSERT_EQUAL(std::string("a"), mock.get().str());
+    }
+
+    void reset_restores_unmocked_methods() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        When(Method(mock, func)).AlwaysReturn(1);
+        mock.Reset();
+
+        ASSERT_THROW(mock.get().func(1), fakeit::UnexpectedMethodCallException);
+        When(Method(mock, func)).AlwaysReturn(2);
+        ASSERT_EQUAL(2, mock.get().func(1));
+    }
+
+} __ConstantReturnTests;
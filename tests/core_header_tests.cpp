@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include "tpunit++.hpp"
+#include "fakeit_core.hpp"
+
+#ifdef Verify
+#error "fakeit_core.hpp should not define the verification API"
+#endif
+
+using namespace fakeit;
+
+struct CoreHeaderTests : tpunit::TestFixture {
+
+    CoreHeaderTests() :
+            tpunit::TestFixture(
+                    //
+                    TEST(CoreHeaderTests::stub_with_core_header_only),
+                    TEST(CoreHeaderTests::unmocked_method_throws_with_core_header_only)
+                    //
+            ) {
+    }
+
+    struct SomeInterface {
+        virtual int func(int) = 0;
+
+        virtual void proc(int) = 0;
+    };
+
+    void stub_with_core_header_only() {
+        Mock<SomeInterface> mock;
+        When(Method(mock, func).Using(1)).Return(1);
+        Fake(Method(mock, proc));
+
+        ASSERT_EQUAL(1, mock.get().func(1));
+        mock.get().proc(1);
+    }
+
+    void unmocked_method_throws_with_core_header_only() {
+        Mock<SomeInterface> mock;
+        ASSERT_THROW(mock.get().func(1), fakeit::UnexpectedMethodCallException);
+    }
+
+} __CoreHeaderTests;
@@ -21,6 +21,7 @@ struct CustomEventFormatting : tpunit::TestFixture {
 	tpunit::TestFixture(
 	//
 	TEST(CustomEventFormatting::format_UnexpectedMethodCallEvent),
+	TEST(CustomEventFormatting::format_UnexpectedMethodCallEvent_only_when_needed),
 	TEST(CustomEventFormatting::format_SequenceVerificationEvent),
 	TEST(CustomEventFormatting::format_NoMoreInvocationsVerificationEvent)
 	) //
@@ -30,9 +31,13 @@ struct CustomEventFormatting : tpunit::TestFixture {
 	class CustomEventFormatter : public EventFormatter {
 
 		virtual std::string format(const fakeit::UnexpectedMethodCallEvent&) {
+			unexpectedMethodCallFormats++;
 			return{ "UnexpectedMethodCallEvent" };
 		}
 
+	public:
+		int unexpectedMethodCallFormats = 0;
+
 		virtual std::string format(const fakeit::SequenceVerificationEvent&) {
 			return{ "SequenceVerificationEvent" };
 		}
@@ -76,9 +81,11 @@ struct CustomEventFormatting : tpunit::TestFixture {
 #endif
     }
 
-	static void setup() {
+	static CustomEventFormatter &setup() {
 		static CustomEventFormatter formatter;
+		formatter.unexpectedMethodCallFormats = 0;
 		Fakeit.setCustomEventFormatter(formatter);
+		return formatter;
 	}
 
 	static void teardown() {
@@ -103,6 +110,32 @@ struct CustomEventFormatting : tpunit::TestFixture {
 	}
 
 
+	void format_UnexpectedMethodCallEvent_only_when_needed() {
+		CustomEventFormatter &formatter = setup();
+		finally onExit(teardown);
+		Mock<SomeInterface> mock;
+		When(Method(mock, func).Using(1)).AlwaysReturn(1);
+		SomeInterface &i = mock.get();
+		for (int n = 0; n < 100; n++) {
+			try {
+				i.func(2);
+				FAIL();
+			}
+			catch (UnexpectedMethodCallException&) {
+			}
+		}
+		ASSERT_EQUAL(0, formatter.unexpectedMethodCallFormats);
+		try {
+			i.func(2);
+			FAIL();
+		}
+		catch (UnexpectedMethodCallException& e) {
+			ASSERT_EQUAL(std::string("UnexpectedMethodCallEvent"), e.what());
+			ASSERT_EQUAL(std::string("UnexpectedMethodCallEvent"), e.what());
+			ASSERT_EQUAL(1, formatter.unexpectedMethodCallFormats);
+		}
+	}
+
 	void format_SequenceVerificationEvent() {
 		setup();
 		finally onExit(teardown);
@@ -8,13 +8,33 @@
 
 #include <string>
 #include <iosfwd>
+#include <memory>
 #include <stdexcept>
 #include <tuple>
+#include <vector>
 
 #include "tpunit++.hpp"
 #include "fakeit.hpp"
 #include <fakeit/api_functors.hpp>
 
+struct CountedFormatting {
+	int value;
+	static int formats;
+};
+
+int CountedFormatting::formats = 0;
+
+namespace fakeit {
+
+	template<> struct Formatter<CountedFormatting> {
+		static std::string format(const CountedFormatting& c) {
+			CountedFormatting::formats++;
+			return std::to_string(c.value);
+		}
+	};
+
+}
+
 using namespace fakeit;
 
 struct DefaultEventFormatting: tpunit::TestFixture {
@@ -23,16 +43,24 @@ struct DefaultEventFormatting: tpunit::TestFixture {
 			//
 			TEST(DefaultEventFormatting::format_UnmockedMethodCallEvent),
 			TEST(DefaultEventFormatting::format_UnmatchedMethodCallEvent),
+			TEST(DefaultEventFormatting::format_UnmatchedMethodCallEvent_after_the_mock_is_destroyed),
+			TEST(DefaultEventFormatting::format_arguments_of_UnmatchedMethodCallEvent_only_on_what),
+			TEST(DefaultEventFormatting::format_UnmatchedMethodCallEvent_with_arguments_that_are_not_copied),
 			TEST(DefaultEventFormatting::format_AnyArguments),
 			TEST(DefaultEventFormatting::format_Exactly_Once),
 			TEST(DefaultEventFormatting::format_Atleast_Once),
+			TEST(DefaultEventFormatting::format_AtMost_pointing_at_the_match_over_the_limit),
+			TEST(DefaultEventFormatting::format_Between),
 			TEST(DefaultEventFormatting::format_NoMoreInvocations_VerificationFailure),
 			TEST(DefaultEventFormatting::format_UserDefinedMatcher_in_expected_pattern),
 			TEST(DefaultEventFormatting::format_actual_arguments),
 			TEST(DefaultEventFormatting::format_expected_arguments),
 			TEST(DefaultEventFormatting::format_expected_concatenated_sequence),
 			TEST(DefaultEventFormatting::format_expected_repeated_sequence),
-			TEST(DefaultEventFormatting::format_complex_sequence)
+			TEST(DefaultEventFormatting::format_complex_sequence),
+			TEST(DefaultEventFormatting::format_closest_match_with_repeated_invocations),
+			TEST(DefaultEventFormatting::format_window_around_closest_match),
+			TEST(DefaultEventFormatting::format_window_in_a_long_run_of_identical_invocations)
 			) //
 	{
 	}
@@ -55,6 +83,8 @@ struct DefaultEventFormatting: tpunit::TestFixture {
 	struct SomeInterface {
 		virtual int func(int) = 0;
 		virtual void proc(int) = 0;
+		virtual void counted(CountedFormatting, const std::string &) = 0;
+		virtual void notCopied(const std::vector<std::unique_ptr<int>> &, const char *) = 0;
 
 		virtual int all_types(
 			char, 
@@ -102,6 +132,67 @@ struct DefaultEventFormatting: tpunit::TestFixture {
 		}
 	}
 
+	void format_UnmatchedMethodCallEvent_after_the_mock_is_destroyed() {
+		std::string actual;
+		try {
+			Mock<SomeInterface> mock;
+			Fake(Method(mock,func).Using(3));
+			mock.get().func(1);
+			FAIL();
+		}
+		catch (UnexpectedMethodCallException& e)
+		{
+			actual = to_string(e);
+		}
+		std::string expectedMsg{"Unexpected method invocation: mock.func(1)\n  Could not find Any recorded behavior to support this method call."};
+		ASSERT_EQUAL(expectedMsg, actual);
+	}
+
+	void format_arguments_of_UnmatchedMethodCallEvent_only_on_what() {
+		CountedFormatting::formats = 0;
+		Mock<SomeInterface> mock;
+		When(Method(mock, counted).Matching([](CountedFormatting &c, const std::string &) { return c.value == 0; })).Return();
+		SomeInterface &i = mock.get();
+		for (int n = 0; n < 100; n++) {
+			try {
+				i.counted(CountedFormatting{n + 1}, std::string("temporary"));
+				FAIL();
+			}
+			catch (UnexpectedMethodCallException&) {
+			}
+		}
+		ASSERT_EQUAL(0, CountedFormatting::formats);
+		std::string actual;
+		try {
+			i.counted(CountedFormatting{7}, std::string("temporary"));
+			FAIL();
+		}
+		catch (UnexpectedMethodCallException& e)
+		{
+			actual = to_string(e);
+		}
+		ASSERT_EQUAL(1, CountedFormatting::formats);
+		std::string expectedMsg{"Unexpected method invocation: mock.counted(7, temporary)\n  Could not find Any recorded behavior to support this method call."};
+		ASSERT_EQUAL(expectedMsg, actual);
+	}
+
+	void format_UnmatchedMethodCallEvent_with_arguments_that_are_not_copied() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, notCopied).Matching([](const std::vector<std::unique_ptr<int>> &, const char *) { return false; })).Return();
+		std::string actual;
+		try {
+			std::string text("text");
+			mock.get().notCopied(std::vector<std::unique_ptr<int>>(), text.c_str());
+			FAIL();
+		}
+		catch (UnexpectedMethodCallException& e)
+		{
+			actual = to_string(e);
+		}
+		std::string expectedMsg{"Unexpected method invocation: mock.notCopied(?, text)\n  Could not find Any recorded behavior to support this method call."};
+		ASSERT_EQUAL(expectedMsg, actual);
+	}
+
 	void format_AnyArguments() {
 		Mock<SomeInterface> mock;
 		try {
@@ -155,6 +246,53 @@ struct DefaultEventFormatting: tpunit::TestFixture {
 		}
 	}
 
+	void format_AtMost_pointing_at_the_match_over_the_limit() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		SomeInterface &i = mock.get();
+		for (int n = 0; n < 30; n++)
+			i.func(n % 10);
+		try {
+			fakeit::Verify(Method(mock, func).Using(7)).setFileInfo("test file", 1, "test method").AtMost(Once);
+			FAIL();
+		}
+		catch (SequenceVerificationException& e) {
+			std::string expectedMsg{ formatLineNumner("test file", 1) };
+			expectedMsg += ": Verification error\n";
+			expectedMsg += "Expected pattern: mock.func(7)\n";
+			expectedMsg += "Expected matches: at most 1\n";
+			expectedMsg += "Actual matches  : more than 1\n";
+			expectedMsg += "Actual sequence : total of 30 actual invocations:\n";
+			expectedMsg += "  ...\n";
+			expectedMsg += "  mock.func(5)\n";
+			expectedMsg += "  mock.func(6)\n";
+			expectedMsg += "  mock.func(7)\n";
+			expectedMsg += "  mock.func(8)\n";
+			expectedMsg += "  mock.func(9)\n";
+			expectedMsg += "  ...";
+			std::string actualMsg{ to_string(e) };
+			ASSERT_EQUAL(expectedMsg, actualMsg);
+		}
+	}
+
+	void format_Between() {
+		Mock<SomeInterface> mock;
+		try {
+			fakeit::Verify(Method(mock, func)).setFileInfo("test file", 1, "test method").Between(1, 3);
+			FAIL();
+		}
+		catch (SequenceVerificationException& e) {
+			std::string expectedMsg{ formatLineNumner("test file", 1) };
+			expectedMsg += ": Verification error\n";
+			expectedMsg += "Expected pattern: mock.func( Any arguments )\n";
+			expectedMsg += "Expected matches: between 1 and 3\n";
+			expectedMsg += "Actual matches  : 0\n";
+			expectedMsg += "Actual sequence : total of 0 actual invocations.";
+			std::string actualMsg{ to_string(e) };
+			ASSERT_EQUAL(expectedMsg, actualMsg);
+		}
+	}
+
 	void format_NoMoreInvocations_VerificationFailure() {
 		Mock<SomeInterface> mock;
 		try {
@@ -329,4 +467,104 @@ struct DefaultEventFormatting: tpunit::TestFixture {
 
 	}
 
+	void format_closest_match_with_repeated_invocations() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func), Method(mock, proc));
+		SomeInterface &i = mock.get();
+		for (int n = 0; n < 10; n++)
+			i.func(0);
+		i.proc(9);
+		i.func(1);
+		i.proc(2);
+		i.proc(5);
+		i.func(4);
+		i.func(6);
+		for (int n = 0; n < 4; n++)
+			i.proc(8);
+		try {
+			fakeit::Verify(Method(mock, func).Using(1) + Method(mock, proc).Using(2) + Method(mock, proc).Using(3)) //
+				.setFileInfo("test file", 1, "test method");
+			FAIL();
+		}
+		catch (SequenceVerificationException& e)
+		{
+			std::string expectedMsg{ formatLineNumner("test file", 1) };
+			expectedMsg += ": Verification error\n";
+			expectedMsg += "Expected pattern: mock.func(1) + mock.proc(2) + mock.proc(3)\n";
+			expectedMsg += "Expected matches: at least 1\n";
+			expectedMsg += "Actual matches  : 0\n";
+			expectedMsg += "Closest match   : 2 of 3 expected invocations, from actual invocation #12\n";
+			expectedMsg += "Actual sequence : total of 20 actual invocations:\n";
+			expectedMsg += "  mock.func(0) (10 times)\n";
+			expectedMsg += "  mock.proc(9)\n";
+			expectedMsg += "  mock.func(1)\n";
+			expectedMsg += "  mock.proc(2)\n";
+			expectedMsg += "  mock.proc(5)\n";
+			expectedMsg += "  ...";
+			std::string actual{ to_string(e) };
+			ASSERT_EQUAL(expectedMsg, actual);
+		}
+	}
+
+	void format_window_around_closest_match() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func), Method(mock, proc));
+		SomeInterface &i = mock.get();
+		for (int n = 0; n < 30; n++)
+			i.func(n);
+		try {
+			fakeit::Verify(Method(mock, func).Using(20) + Method(mock, proc).Using(1)) //
+				.setFileInfo("test file", 1, "test method");
+			FAIL();
+		}
+		catch (SequenceVerificationException& e)
+		{
+			std::string expectedMsg{ formatLineNumner("test file", 1) };
+			expectedMsg += ": Verification error\n";
+			expectedMsg += "Expected pattern: mock.func(20) + mock.proc(1)\n";
+			expectedMsg += "Expected matches: at least 1\n";
+			expectedMsg += "Actual matches  : 0\n";
+			expectedMsg += "Closest match   : 1 of 2 expected invocations, from actual invocation #21\n";
+			expectedMsg += "Actual sequence : total of 30 actual invocations:\n";
+			expectedMsg += "  ...\n";
+			expectedMsg += "  mock.func(18)\n";
+			expectedMsg += "  mock.func(19)\n";
+			expectedMsg += "  mock.func(20)\n";
+			expectedMsg += "  mock.func(21)\n";
+			expectedMsg += "  mock.func(22)\n";
+			expectedMsg += "  ...";
+			std::string actual{ to_string(e) };
+			ASSERT_EQUAL(expectedMsg, actual);
+		}
+	}
+
+	void format_window_in_a_long_run_of_identical_invocations() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func), Method(mock, proc));
+		SomeInterface &i = mock.get();
+		for (int n = 0; n < 1000; n++)
+			i.func(0);
+		i.proc(1);
+		try {
+			fakeit::Verify(Method(mock, proc).Using(1) + Method(mock, func).Using(0)) //
+				.setFileInfo("test file", 1, "test method");
+			FAIL();
+		}
+		catch (SequenceVerificationException& e)
+		{
+			std::string expectedMsg{ formatLineNumner("test file", 1) };
+			expectedMsg += ": Verification error\n";
+			expectedMsg += "Expected pattern: mock.proc(1) + mock.func(0)\n";
+			expectedMsg += "Expected matches: at least 1\n";
+			expectedMsg += "Actual matches  : 0\n";
+			expectedMsg += "Closest match   : 1 of 2 expected invocations, from actual invocation #1001\n";
+			expectedMsg += "Actual sequence : total of 1001 actual invocations:\n";
+			expectedMsg += "  ...\n";
+			expectedMsg += "  mock.func(0) (at least 100 times)\n";
+			expectedMsg += "  mock.proc(1)";
+			std::string actual{ to_string(e) };
+			ASSERT_EQUAL(expectedMsg, actual);
+		}
+	}
+
 } __DefaultEventFormatting;
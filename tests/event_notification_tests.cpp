@@ -10,12 +10,19 @@
 #include <iosfwd>
 #include <stdexcept>
 #include <tuple>
+#include <type_traits>
 
 #include "tpunit++.hpp"
 #include "fakeit.hpp"
 
 using namespace fakeit;
 
+// the events refer to the state of what fired them, keeping a copy of one would dangle.
+static_assert(!std::is_copy_constructible<SequenceVerificationEvent>::value, "events are not copyable");
+static_assert(!std::is_copy_constructible<NoMoreInvocationsVerificationEvent>::value, "events are not copyable");
+static_assert(!std::is_copy_constructible<UnexpectedMethodCallEvent>::value, "events are not copyable");
+static_assert(!std::is_copy_constructible<InvocationEvent>::value, "events are not copyable");
+
 struct EventNotification: tpunit::TestFixture {
 	EventNotification()
 			: tpunit::TestFixture(
@@ -23,6 +30,7 @@ struct EventNotification: tpunit::TestFixture {
 					TEST(EventNotification::handle_UnexpectedMethodCallEvent),
 					TEST(EventNotification::handle_SequenceVerificationEvent),
 					TEST(EventNotification::handle_NoMoreInvocationsVerificationEvent),
+					TEST(EventNotification::verification_events_refer_to_all_the_invocations),
 					TEST(
 							EventNotification::ShouldThrow_UnexpectedMethodCallException_IfAdapterDidNotThrowException_WhenHandlingAnUnmatchedInvocation),
 					TEST(
@@ -72,6 +80,25 @@ struct EventNotification: tpunit::TestFixture {
 		NullEventHandler() = default;
 	};
 
+	class InvocationCountingListener: public FakeEventListener {
+	public:
+
+		virtual void handle(const SequenceVerificationEvent& e) override {
+			actualSequence = e.actualSequence().toVector();
+			FakeEventListener::handle(e);
+		}
+
+		virtual void handle(const NoMoreInvocationsVerificationEvent& e) override {
+			allInvocations = e.allIvocations().toVector();
+			unverifiedInvocations = e.unverifedIvocations().toVector();
+			FakeEventListener::handle(e);
+		}
+
+		std::vector<Invocation *> actualSequence;
+		std::vector<Invocation *> allInvocations;
+		std::vector<Invocation *> unverifiedInvocations;
+	};
+
 	template<typename T> std::string to_string(T& val) {
 		std::stringstream stream;
 		stream << val;
@@ -151,6 +178,30 @@ struct EventNotification: tpunit::TestFixture {
 		}
 	}
 
+	void verification_events_refer_to_all_the_invocations() {
+		InvocationCountingListener listener;
+		Fakeit.addEventHandler(listener);
+		finally onExit(teardown);
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		for (int n = 0; n < 100; n++)
+			mock.get().func(n);
+		try {
+			fakeit::Verify(Method(mock, func)).setFileInfo("test file", 1, "test method").Exactly(Once);
+			FAIL();
+		} catch (FakeEventListener::AssertionException&) {
+		}
+		ASSERT_EQUAL(100, listener.actualSequence.size());
+		ASSERT_TRUE(listener.actualSequence[0]->getOrdinal() < listener.actualSequence[99]->getOrdinal());
+		try {
+			fakeit::VerifyNoOtherInvocations(Method(mock, func)).setFileInfo("test file", 1, "test method");
+			FAIL();
+		} catch (FakeEventListener::AssertionException&) {
+		}
+		ASSERT_EQUAL(100, listener.allInvocations.size());
+		ASSERT_EQUAL(100, listener.unverifiedInvocations.size());
+	}
+
 	void ShouldThrow_UnexpectedMethodCallException_IfAdapterDidNotThrowException_WhenHandlingAnUnmatchedInvocation() {
 		setup();
 		finally onExit(teardown);
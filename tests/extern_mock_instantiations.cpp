@@ -0,0 +1,12 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include "extern_mock_types.hpp"
+
+FAKEIT_INSTANTIATE_MOCK(ExternMockedInterface);
+FAKEIT_INSTANTIATE_MOCK(ExternMockedDerivedInterface, ExternMockedBaseInterface);
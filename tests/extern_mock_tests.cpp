@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+// the mocks of these types are only declared here, see extern_mock_instantiations.cpp.
+#include "extern_mock_types.hpp"
+
+using namespace fakeit;
+
+struct ExternMockTests : tpunit::TestFixture {
+
+    ExternMockTests() :
+            tpunit::TestFixture(
+                    //
+                    TEST(ExternMockTests::mock_explicitly_instantiated_type),
+                    TEST(ExternMockTests::mock_explicitly_instantiated_type_with_base_class)
+                    //
+            ) {
+    }
+
+    void mock_explicitly_instantiated_type() {
+        Mock<ExternMockedInterface> mock;
+        When(Method(mock, func)).Return(1);
+        Fake(Method(mock, proc));
+
+        ASSERT_EQUAL(1, mock.get().func(1));
+        mock.get().proc(1);
+        Verify(Method(mock, func), Method(mock, proc));
+    }
+
+    void mock_explicitly_instantiated_type_with_base_class() {
+        Mock<ExternMockedDerivedInterface, ExternMockedBaseInterface> mock;
+        When(Method(mock, func)).Return(1);
+        Fake(Method(mock, proc), Dtor(mock));
+
+        ExternMockedDerivedInterface &i = mock.get();
+        ASSERT_EQUAL(1, i.func(1));
+        i.proc(1);
+        Verify(Method(mock, func)).Once();
+    }
+
+} __ExternMockTests;
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+#pragma once
+
+#include "fakeit.hpp"
+
+// The mocked types of extern_mock_tests.cpp, instantiated in extern_mock_instantiations.cpp.
+
+struct ExternMockedInterface {
+    virtual int func(int) = 0;
+
+    virtual void proc(int) = 0;
+};
+
+struct ExternMockedBaseInterface {
+    virtual ~ExternMockedBaseInterface() = default;
+
+    virtual int func(int) = 0;
+};
+
+struct ExternMockedDerivedInterface : public ExternMockedBaseInterface {
+    virtual void proc(int) = 0;
+};
+
+FAKEIT_EXTERN_MOCK(ExternMockedInterface);
+FAKEIT_EXTERN_MOCK(ExternMockedDerivedInterface, ExternMockedBaseInterface);
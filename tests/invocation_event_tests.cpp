@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct InvocationEventTests: tpunit::TestFixture {
+	InvocationEventTests()
+			: tpunit::TestFixture(
+					//
+					TEST(InvocationEventTests::notify_every_invocation),
+					TEST(InvocationEventTests::view_arguments),
+					TEST(InvocationEventTests::notify_unmatched_invocations),
+					TEST(InvocationEventTests::notify_constant_stubs_without_history),
+					TEST(InvocationEventTests::notify_completion_of_nested_and_failed_calls),
+					TEST(InvocationEventTests::throw_from_completion_handler),
+					TEST(InvocationEventTests::stop_notifying_when_cleared)
+			) //
+	{
+	}
+
+	struct SomeInterface {
+		virtual int func(int, const std::string &) = 0;
+		virtual void proc() = 0;
+	};
+
+	struct RecordingHandler : public InvocationEventHandler {
+		virtual void handle(const InvocationEvent &e) override {
+			methodIds.push_back(e.getMethod().id());
+			ordinals.push_back(e.getOrdinal());
+			std::string args;
+			e.getArguments().formatTo(args);
+			arguments.push_back(args);
+			const int *i = e.getArguments().get<int>(0);
+			ints.push_back(i ? *i : -1);
+			const std::string *s = e.getArguments().get<std::string>(1);
+			strings.push_back(s ? *s : "-");
+		}
+
+		virtual void handleCompletion(const InvocationEvent &e) override {
+			completedOrdinals.push_back(e.getOrdinal());
+		}
+
+		std::vector<unsigned int> methodIds;
+		std::vector<unsigned int> ordinals;
+		std::vector<unsigned int> completedOrdinals;
+		std::vector<std::string> arguments;
+		std::vector<int> ints;
+		std::vector<std::string> strings;
+	};
+
+	struct ThrowingCompletionHandler : public InvocationEventHandler {
+		virtual void handle(const InvocationEvent &) override {
+		}
+
+		virtual void handleCompletion(const InvocationEvent &) override {
+			throw std::runtime_error("completion");
+		}
+	};
+
+	static void teardown() {
+		Fakeit.clearInvocationEventHandlers();
+	}
+
+	class finally {
+	private:
+		std::function<void()> finallyClause;
+		finally(const finally &);
+		finally& operator=(const finally &);
+	public:
+		explicit finally(std::function<void()> f)
+				: finallyClause(f) {
+		}
+
+		~finally() {
+			finallyClause();
+		}
+	};
+
+	void notify_every_invocation() {
+		RecordingHandler handler;
+		Fakeit.addInvocationEventHandler(handler);
+		finally onExit(teardown);
+		Mock<SomeInterface> mock;
+		When(Method(mock, func)).AlwaysReturn(1);
+		Fake(Method(mock, proc));
+		SomeInterface &i = mock.get();
+		i.func(1, "a");
+		i.proc();
+		i.func(2, "b");
+
+		ASSERT_EQUAL(3, handler.methodIds.size());
+		ASSERT_EQUAL(handler.methodIds[0], handler.methodIds[2]);
+		ASSERT_NOT_EQUAL(handler.methodIds[0], handler.methodIds[1]);
+		ASSERT_TRUE(handler.ordinals[0] < handler.ordinals[1]);
+		ASSERT_TRUE(handler.ordinals[1] < handler.ordinals[2]);
+		Verify(Method(mock, func)).Twice();
+	}
+
+	void view_arguments() {
+		RecordingHandler handler;
+		Fakeit.addInvocationEventHandler(handler);
+		finally onExit(teardown);
+		Mock<SomeInterface> mock;
+		When(Method(mock, func)).AlwaysReturn(1);
+		Fake(Method(mock, proc));
+		SomeInterface &i = mock.get();
+		i.func(7, "text");
+		i.proc();
+
+		ASSERT_EQUAL(std::string("(7, text)"), handler.arguments[0]);
+		ASSERT_EQUAL(7, handler.ints[0]);
+		ASSERT_EQUAL(std::string("text"), handler.strings[0]);
+		ASSERT_EQUAL(std::string("()"), handler.arguments[1]);
+		ASSERT_EQUAL(-1, handler.ints[1]);
+		ASSERT_EQUAL(std::string("-"), handler.strings[1]);
+	}
+
+	void notify_unmatched_invocations() {
+		RecordingHandler handler;
+		Fakeit.addInvocationEventHandler(handler);
+		finally onExit(teardown);
+		Mock<SomeInterface> mock;
+		When(Method(mock, func).Using(1, "a")).AlwaysReturn(1);
+		try {
+			mock.get().func(2, "b");
+			FAIL();
+		} catch (UnexpectedMethodCallException&) {
+		}
+		ASSERT_EQUAL(1, handler.arguments.size());
+		ASSERT_EQUAL(std::string("(2, b)"), handler.arguments[0]);
+	}
+
+	void notify_constant_stubs_without_history() {
+		finally onExit(teardown);
+		Mock<SomeInterface> mock;
+		mock.DisableInvocationHistory();
+		When(Method(mock, func)).AlwaysReturn(1);
+		Fake(Method(mock, proc));
+		SomeInterface &i = mock.get();
+		RecordingHandler handler;
+		Fakeit.addInvocationEventHandler(handler);
+		for (int n = 0; n < 5; n++) {
+			ASSERT_EQUAL(1, i.func(n, "a"));
+			i.proc();
+		}
+		ASSERT_EQUAL(10, handler.ordinals.size());
+		ASSERT_EQUAL(10, handler.completedOrdinals.size());
+
+		Fakeit.removeInvocationEventHandler(handler);
+		ASSERT_EQUAL(1, i.func(5, "a"));
+		ASSERT_EQUAL(10, handler.ordinals.size());
+
+		RecordingHandler other;
+		Fakeit.addInvocationEventHandler(other);
+		When(Method(mock, func)).AlwaysReturn(2);
+		ASSERT_EQUAL(2, i.func(6, "a"));
+		ASSERT_EQUAL(1, other.ordinals.size());
+	}
+
+	void notify_completion_of_nested_and_failed_calls() {
+		RecordingHandler handler;
+		Fakeit.addInvocationEventHandler(handler);
+		finally onExit(teardown);
+		Mock<SomeInterface> mock;
+		SomeInterface &i = mock.get();
+		Fake(Method(mock, proc));
+		When(Method(mock, func).Using(1, "a")).AlwaysDo([&](int, const std::string &) { i.proc(); return 1; });
+		i.func(1, "a");
+		ASSERT_THROW(i.func(2, "b"), UnexpectedMethodCallException);
+
+		ASSERT_EQUAL(3, handler.completedOrdinals.size());
+		ASSERT_EQUAL(handler.ordinals[1], handler.completedOrdinals[0]);
+		ASSERT_EQUAL(handler.ordinals[0], handler.completedOrdinals[1]);
+		ASSERT_EQUAL(handler.ordinals[2], handler.completedOrdinals[2]);
+	}
+
+	void throw_from_completion_handler() {
+		ThrowingCompletionHandler handler;
+		Fakeit.addInvocationEventHandler(handler);
+		finally onExit(teardown);
+		Mock<SomeInterface> mock;
+		When(Method(mock, func).Using(1, "a")).AlwaysReturn(1);
+		When(Method(mock, proc)).AlwaysThrow(std::invalid_argument("proc"));
+		SomeInterface &i = mock.get();
+		// the call completed, so the exception of the handler is thrown.
+		ASSERT_THROW(i.func(1, "a"), std::runtime_error);
+		// the call threw, so its own exception is thrown.
+		ASSERT_THROW(i.proc(), std::invalid_argument);
+		ASSERT_THROW(i.func(2, "b"), UnexpectedMethodCallException);
+	}
+
+	void stop_notifying_when_cleared() {
+		RecordingHandler handler;
+		Fakeit.addInvocationEventHandler(handler);
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, proc));
+		mock.get().proc();
+		Fakeit.clearInvocationEventHandlers();
+		mock.get().proc();
+		ASSERT_EQUAL(1, handler.methodIds.size());
+	}
+
+} __InvocationEventTests;
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <chrono>
+#include <thread>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct MethodStatsTests: tpunit::TestFixture {
+	MethodStatsTests()
+			: tpunit::TestFixture(
+					//
+					TEST(MethodStatsTests::count_matched_and_unmatched_calls),
+					TEST(MethodStatsTests::count_calls_without_history),
+					TEST(MethodStatsTests::count_constant_stub_calls_without_history),
+					TEST(MethodStatsTests::stats_are_per_method),
+					TEST(MethodStatsTests::clear_invocation_history_resets_stats),
+					TEST(MethodStatsTests::measure_latency_when_timing_is_enabled),
+					TEST(MethodStatsTests::reenabling_timing_starts_over),
+					TEST(MethodStatsTests::histogram_percentiles)
+			) //
+	{
+	}
+
+	struct SomeInterface {
+		virtual int func(int) = 0;
+		virtual void proc(int) = 0;
+	};
+
+	void count_matched_and_unmatched_calls() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, func).Using(1)).AlwaysReturn(1);
+		SomeInterface &i = mock.get();
+		i.func(1);
+		i.func(1);
+		try {
+			i.func(2);
+			FAIL();
+		} catch (UnexpectedMethodCallException&) {
+		}
+
+		MethodStats &stats = mock.Stats(Method(mock, func));
+		ASSERT_EQUAL(3, stats.calls());
+		ASSERT_EQUAL(2, stats.matched());
+		ASSERT_EQUAL(1, stats.unmatched());
+		ASSERT_FALSE(stats.isTimingEnabled());
+		ASSERT_EQUAL(0, stats.timedCalls());
+	}
+
+	void count_calls_without_history() {
+		Mock<SomeInterface> mock;
+		mock.DisableInvocationHistory();
+		int sum = 0;
+		When(Method(mock, proc)).AlwaysDo([&](int n) { sum += n; });
+		for (int n = 0; n < 100; n++)
+			mock.get().proc(n);
+		ASSERT_EQUAL(100, mock.Stats(Method(mock, proc)).calls());
+		ASSERT_EQUAL(4950, sum);
+	}
+
+	void count_constant_stub_calls_without_history() {
+		Mock<SomeInterface> mock;
+		mock.DisableInvocationHistory();
+		When(Method(mock, func)).AlwaysReturn(1);
+		Fake(Method(mock, proc));
+		SomeInterface &i = mock.get();
+		for (int n = 0; n < 5; n++) {
+			ASSERT_EQUAL(1, i.func(n));
+			i.proc(n);
+		}
+		ASSERT_EQUAL(5, mock.Stats(Method(mock, func)).calls());
+		ASSERT_EQUAL(5, mock.Stats(Method(mock, func)).matched());
+		ASSERT_EQUAL(5, mock.Stats(Method(mock, proc)).calls());
+	}
+
+	void stats_are_per_method() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func), Method(mock, proc));
+		mock.get().func(1);
+		ASSERT_EQUAL(1, mock.Stats(Method(mock, func)).calls());
+		ASSERT_EQUAL(0, mock.Stats(Method(mock, proc)).calls());
+	}
+
+	void clear_invocation_history_resets_stats() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock, func));
+		mock.get().func(1);
+		mock.ClearInvocationHistory();
+		ASSERT_EQUAL(0, mock.Stats(Method(mock, func)).calls());
+	}
+
+	void measure_latency_when_timing_is_enabled() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, proc)).AlwaysDo([](int millis) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+		});
+		MethodStats &stats = mock.Stats(Method(mock, proc));
+		mock.get().proc(0);
+		stats.setTimingEnabled(true);
+		mock.get().proc(1);
+		mock.get().proc(2);
+		mock.get().proc(1);
+
+		ASSERT_EQUAL(4, stats.calls());
+		ASSERT_EQUAL(3, stats.timedCalls());
+		ASSERT_TRUE(stats.minNanos() >= 1000000);
+		ASSERT_TRUE(stats.maxNanos() >= 2000000);
+		ASSERT_TRUE(stats.minNanos() <= stats.meanNanos());
+		ASSERT_TRUE(stats.meanNanos() <= stats.maxNanos());
+		ASSERT_TRUE(stats.percentileNanos(100) >= stats.maxNanos());
+		ASSERT_TRUE(stats.percentileNanos(50) >= stats.minNanos());
+
+		stats.setTimingEnabled(false);
+		mock.get().proc(0);
+		ASSERT_EQUAL(0, stats.timedCalls());
+		ASSERT_EQUAL(5, stats.calls());
+	}
+
+	void reenabling_timing_starts_over() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, proc)).AlwaysDo([](int millis) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+		});
+		MethodStats &stats = mock.Stats(Method(mock, proc));
+		stats.setTimingEnabled(true);
+		mock.get().proc(20);
+		stats.setTimingEnabled(false);
+		ASSERT_EQUAL(0, stats.minNanos());
+		ASSERT_EQUAL(0, stats.maxNanos());
+		ASSERT_EQUAL(0, stats.meanNanos());
+
+		stats.setTimingEnabled(true);
+		mock.get().proc(0);
+		ASSERT_EQUAL(1, stats.timedCalls());
+		ASSERT_TRUE(stats.maxNanos() < 20000000);
+		ASSERT_EQUAL((double) stats.maxNanos(), stats.meanNanos());
+		ASSERT_EQUAL(stats.minNanos(), stats.maxNanos());
+	}
+
+	void histogram_percentiles() {
+		LatencyHistogram histogram;
+		ASSERT_EQUAL(0, histogram.percentile(50));
+		for (unsigned long long v = 1; v <= 1000; v++)
+			histogram.record(v);
+		ASSERT_EQUAL(1000, histogram.count());
+		unsigned long long median = histogram.percentile(50);
+		ASSERT_TRUE(median >= 500 && median < 500 * 5 / 4);
+		unsigned long long p99 = histogram.percentile(99);
+		ASSERT_TRUE(p99 >= 990 && p99 < 990 * 5 / 4);
+		ASSERT_EQUAL(1, histogram.percentile(0.1));
+		for (unsigned long long v : {0ULL, 3ULL, 4ULL, 5ULL, 7ULL, 8ULL, 1000ULL, ~0ULL}) {
+			std::size_t bucket = LatencyHistogram::bucketOf(v);
+			ASSERT_TRUE(LatencyHistogram::lowerBoundOf(bucket) <= v);
+			ASSERT_TRUE(v <= LatencyHistogram::upperBoundOf(bucket));
+		}
+	}
+
+} __MethodStatsTests;
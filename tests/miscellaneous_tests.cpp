@@ -8,6 +8,7 @@
 
 #include <string>
 #include <queue>
+#include <iostream>
 
 #include "tpunit++.hpp"
 #include "fakeit.hpp"
@@ -18,7 +18,8 @@ struct OverloadedMethods : tpunit::TestFixture {
     OverloadedMethods() :
             tpunit::TestFixture(
                     TEST(OverloadedMethods::stub_overloaded_methods),
-                    TEST(OverloadedMethods::stub_const_overloaded_methods)) {
+                    TEST(OverloadedMethods::stub_const_overloaded_methods),
+                    TEST(OverloadedMethods::stub_overloaded_methods_of_base_class)) {
     }
 
 
@@ -43,6 +44,10 @@ struct OverloadedMethods : tpunit::TestFixture {
 
     };
 
+    struct SomeDerivedInterface : public SomeInterface {
+        virtual void other() = 0;
+    };
+
 
     void stub_overloaded_methods() {
         int x = 5;
@@ -85,4 +90,18 @@ struct OverloadedMethods : tpunit::TestFixture {
         ASSERT_EQUAL(2, constObj.func());
     }
 
+    void stub_overloaded_methods_of_base_class() {
+        Mock<SomeDerivedInterface> mock;
+
+        When(OverloadedMethod(mock, func, int(int))).Return(1);
+        When(ConstOverloadedMethod(mock, func, int())).Return(2);
+        When(Method(mock, other)).Return();
+
+        SomeDerivedInterface &obj = mock.get();
+        const SomeDerivedInterface& constObj = mock.get();
+        ASSERT_EQUAL(1, obj.func(1));
+        ASSERT_EQUAL(2, constObj.func());
+        obj.other();
+    }
+
 } __OverloadedMethods;
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct PrototypeVirtualTableTests : tpunit::TestFixture {
+
+    PrototypeVirtualTableTests() :
+            tpunit::TestFixture(
+                    //
+                    TEST(PrototypeVirtualTableTests::unstubbed_mocks_share_virtual_table),
+                    TEST(PrototypeVirtualTableTests::each_context_has_its_own_virtual_table),
+                    TEST(PrototypeVirtualTableTests::stubbing_clones_virtual_table),
+                    TEST(PrototypeVirtualTableTests::stubbing_does_not_affect_other_mocks),
+                    TEST(PrototypeVirtualTableTests::unmocked_methods_still_throw_after_clone),
+                    TEST(PrototypeVirtualTableTests::reset_returns_to_shared_virtual_table),
+                    TEST(PrototypeVirtualTableTests::spy_keeps_original_virtual_table_until_stubbed),
+                    TEST(PrototypeVirtualTableTests::method_expressions_of_same_method_share_proxy)
+                    //
+            ) {
+    }
+
+    struct SomeInterface {
+        virtual int func(int) = 0;
+
+        virtual void proc(int) = 0;
+    };
+
+    struct SomeClass {
+        virtual int func(int) {
+            return 1;
+        }
+
+        virtual void proc(int) {
+        }
+    };
+
+    template<typename T>
+    static void *getVirtualTable(T &t) {
+        return *reinterpret_cast<void **>(&t);
+    }
+
+    void unstubbed_mocks_share_virtual_table() {
+        Mock<SomeInterface> mock1;
+        Mock<SomeInterface> mock2;
+        ASSERT_EQUAL(getVirtualTable(mock1.get()), getVirtualTable(mock2.get()));
+    }
+
+    void each_context_has_its_own_virtual_table() {
+        StandaloneFakeit context;
+        MockImpl<SomeInterface> mock1(context);
+        MockImpl<SomeInterface> mock2(context);
+        Mock<SomeInterface> mock3;
+        ASSERT_EQUAL(getVirtualTable(mock1.get()), getVirtualTable(mock2.get()));
+        ASSERT_NOT_EQUAL(getVirtualTable(mock1.get()), getVirtualTable(mock3.get()));
+    }
+
+    void stubbing_clones_virtual_table() {
+        Mock<SomeInterface> mock1;
+        Mock<SomeInterface> mock2;
+        When(Method(mock1, func)).Return(1);
+        ASSERT_NOT_EQUAL(getVirtualTable(mock1.get()), getVirtualTable(mock2.get()));
+    }
+
+    void stubbing_does_not_affect_other_mocks() {
+        Mock<SomeInterface> mock1;
+        Mock<SomeInterface> mock2;
+        When(Method(mock1, func)).AlwaysReturn(1);
+        Fake(Method(mock2, proc));
+
+        ASSERT_EQUAL(1, mock1.get().func(1));
+        ASSERT_THROW(mock2.get().func(1), fakeit::UnexpectedMethodCallException);
+        ASSERT_THROW(mock1.get().proc(1), fakeit::UnexpectedMethodCallException);
+        mock2.get().proc(1);
+    }
+
+    void unmocked_methods_still_throw_after_clone() {
+        Mock<SomeInterface> mock;
+        ASSERT_THROW(mock.get().proc(1), fakeit::UnexpectedMethodCallException);
+        When(Method(mock, func)).Return(1);
+        ASSERT_THROW(mock.get().proc(1), fakeit::UnexpectedMethodCallException);
+    }
+
+    void reset_returns_to_shared_virtual_table() {
+        Mock<SomeInterface> mock1;
+        Mock<SomeInterface> mock2;
+        When(Method(mock1, func)).AlwaysReturn(1);
+        mock1.Reset();
+
+        ASSERT_EQUAL(getVirtualTable(mock1.get()), getVirtualTable(mock2.get()));
+        ASSERT_THROW(mock1.get().func(1), fakeit::UnexpectedMethodCallException);
+        When(Method(mock1, func)).AlwaysReturn(2);
+        ASSERT_EQUAL(2, mock1.get().func(1));
+    }
+
+    void spy_keeps_original_virtual_table_until_stubbed() {
+        SomeClass obj;
+        void *original = getVirtualTable(obj);
+        Mock<SomeClass> spy(obj);
+        ASSERT_EQUAL(original, getVirtualTable(spy.get()));
+
+        When(Method(spy, func)).Return(2);
+        ASSERT_NOT_EQUAL(original, getVirtualTable(spy.get()));
+        ASSERT_EQUAL(2, spy.get().func(1));
+    }
+
+    template<typename R, typename ... arglist>
+    static void *getVirtualTableEntry(SomeInterface &i, R(SomeInterface::*vMethod)(arglist...)) {
+        void **vt = *reinterpret_cast<void ***>(&i);
+        return vt[VTUtils::getOffset(vMethod)];
+    }
+
+    void method_expressions_of_same_method_share_proxy() {
+        Mock<SomeInterface> mock1;
+        Mock<SomeInterface> mock2;
+        When(Method(mock1, func)).Return(1);
+        When(Method(mock2, func)).Return(2);
+
+        ASSERT_EQUAL(getVirtualTableEntry(mock1.get(), &SomeInterface::func),
+                     getVirtualTableEntry(mock2.get(), &SomeInterface::func));
+        ASSERT_EQUAL(1, mock1.get().func(1));
+        ASSERT_EQUAL(2, mock2.get().func(1));
+    }
+
+} __PrototypeVirtualTableTests;
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <set>
+#include <string>
+#include <vector>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+struct SetArgumentMatchingTests: tpunit::TestFixture {
+	SetArgumentMatchingTests()
+			: tpunit::TestFixture(
+					//
+					TEST(SetArgumentMatchingTests::test_in_matcher),
+					TEST(SetArgumentMatchingTests::test_in_matcher_with_initializer_list),
+					TEST(SetArgumentMatchingTests::test_in_matcher_with_ordered_values),
+					TEST(SetArgumentMatchingTests::test_not_in_matcher),
+					TEST(SetArgumentMatchingTests::test_between_matcher),
+					TEST(SetArgumentMatchingTests::format_In),
+					TEST(SetArgumentMatchingTests::format_Between)
+			) //
+	{
+	}
+
+	struct Point {
+		int x;
+		int y;
+
+		bool operator==(const Point &other) const {
+			return x == other.x && y == other.y;
+		}
+
+		bool operator<(const Point &other) const {
+			return x < other.x || (x == other.x && y < other.y);
+		}
+	};
+
+	struct SomeInterface {
+		virtual int func(int) = 0;
+		virtual int func2(const std::string &) = 0;
+		virtual int func3(Point) = 0;
+	};
+
+	void test_in_matcher() {
+		std::vector<int> allowedIds;
+		for (int id = 0; id < 10000; id += 2) {
+			allowedIds.push_back(id);
+		}
+		Mock<SomeInterface> mock;
+		When(Method(mock, func).Using(In(allowedIds))).AlwaysReturn(1);
+		When(Method(mock, func2).Using(In(std::set<std::string>{"a", "b"}))).AlwaysReturn(2);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func(0));
+		ASSERT_EQUAL(1, i.func(9998));
+		ASSERT_THROW(i.func(9999), fakeit::UnexpectedMethodCallException);
+		ASSERT_EQUAL(2, i.func2("b"));
+		ASSERT_THROW(i.func2("c"), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_in_matcher_with_initializer_list() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, func).Using(In({1, 3, 5}))).AlwaysReturn(1);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func(3));
+		ASSERT_THROW(i.func(4), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_in_matcher_with_ordered_values() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, func3).Using(In(std::vector<Point>{{3, 4}, {1, 2}}))).AlwaysReturn(1);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func3(Point{1, 2}));
+		ASSERT_EQUAL(1, i.func3(Point{3, 4}));
+		ASSERT_THROW(i.func3(Point{1, 4}), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_not_in_matcher() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, func).Using(NotIn({1, 2}))).AlwaysReturn(1);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func(3));
+		ASSERT_THROW(i.func(1), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_between_matcher() {
+		Mock<SomeInterface> mock;
+		When(Method(mock, func).Using(Between(1, 3))).AlwaysReturn(1);
+
+		SomeInterface &i = mock.get();
+
+		ASSERT_EQUAL(1, i.func(1));
+		ASSERT_EQUAL(1, i.func(3));
+		ASSERT_THROW(i.func(0), fakeit::UnexpectedMethodCallException);
+		ASSERT_THROW(i.func(4), fakeit::UnexpectedMethodCallException);
+		Verify(Method(mock, func).Using(Between(0, 10))).Exactly(2);
+	}
+
+	void format_In() {
+		Mock<SomeInterface> mock;
+		try {
+			fakeit::Verify(Method(mock, func).Using(In({1, 2, 3, 4, 5, 6, 7}))).setFileInfo("test file", 1, "test method").Exactly(Once);
+			FAIL();
+		} catch (SequenceVerificationException& e) {
+			std::string actualMsg { to_string(e) };
+			ASSERT_TRUE(actualMsg.find("Expected pattern: mock.func(In(1, 2, 3, 4, 5, ...))") != std::string::npos);
+		}
+	}
+
+	void format_Between() {
+		Mock<SomeInterface> mock;
+		try {
+			fakeit::Verify(Method(mock, func).Using(Between(1, 3))).setFileInfo("test file", 1, "test method").Exactly(Once);
+			FAIL();
+		} catch (SequenceVerificationException& e) {
+			std::string actualMsg { to_string(e) };
+			ASSERT_TRUE(actualMsg.find("Expected pattern: mock.func(Between(1, 3))") != std::string::npos);
+		}
+	}
+} __SetArgumentMatching;
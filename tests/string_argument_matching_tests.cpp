@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <string>
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+#include "fakeit/string_argument_matchers.hpp"
+
+using namespace fakeit;
+
+struct StringArgumentMatchingTests: tpunit::TestFixture {
+	StringArgumentMatchingTests()
+			: tpunit::TestFixture(
+					//
+					TEST(StringArgumentMatchingTests::test_str_eq_matcher),
+					TEST(StringArgumentMatchingTests::test_starts_with_matcher),
+					TEST(StringArgumentMatchingTests::test_ends_with_matcher),
+					TEST(StringArgumentMatchingTests::test_contains_matcher),
+					TEST(StringArgumentMatchingTests::test_regex_matcher),
+					TEST(StringArgumentMatchingTests::test_regex_matcher_with_basic_grammar),
+					TEST(StringArgumentMatchingTests::test_c_string_matchers),
+					TEST(StringArgumentMatchingTests::literal_prefix_of_pattern),
+					TEST(StringArgumentMatchingTests::format_string_matchers)
+			) //
+	{
+	}
+
+	struct HttpClient {
+		virtual int get(const std::string &path) = 0;
+		virtual int log(const char *message) = 0;
+	};
+
+	void test_str_eq_matcher() {
+		Mock<HttpClient> mock;
+		When(Method(mock, get).Using(StrEq("/a"))).AlwaysReturn(1);
+
+		HttpClient &i = mock.get();
+
+		ASSERT_EQUAL(1, i.get("/a"));
+		ASSERT_THROW(i.get("/ab"), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_starts_with_matcher() {
+		Mock<HttpClient> mock;
+		When(Method(mock, get).Using(StartsWith("/api/"))).AlwaysReturn(1);
+
+		HttpClient &i = mock.get();
+
+		ASSERT_EQUAL(1, i.get("/api/users"));
+		ASSERT_THROW(i.get("/api"), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_ends_with_matcher() {
+		Mock<HttpClient> mock;
+		When(Method(mock, get).Using(EndsWith(".json"))).AlwaysReturn(1);
+
+		HttpClient &i = mock.get();
+
+		ASSERT_EQUAL(1, i.get("/users.json"));
+		ASSERT_THROW(i.get("/users.xml"), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_contains_matcher() {
+		Mock<HttpClient> mock;
+		When(Method(mock, get).Using(Contains("users"))).AlwaysReturn(1);
+
+		HttpClient &i = mock.get();
+
+		ASSERT_EQUAL(1, i.get("/api/users/1"));
+		ASSERT_THROW(i.get("/api/user/1"), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_regex_matcher() {
+		Mock<HttpClient> mock;
+		When(Method(mock, get).Using(Matches("/api/users/[0-9]+"))).AlwaysReturn(1);
+		When(Method(mock, get).Using(Matches("/API/GROUPS/.*", std::regex_constants::icase))).AlwaysReturn(2);
+
+		HttpClient &i = mock.get();
+
+		ASSERT_EQUAL(1, i.get("/api/users/12"));
+		ASSERT_EQUAL(2, i.get("/api/groups/x"));
+		ASSERT_THROW(i.get("/api/users/x"), fakeit::UnexpectedMethodCallException);
+		ASSERT_THROW(i.get("/other/users/12"), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_regex_matcher_with_basic_grammar() {
+		Mock<HttpClient> mock;
+		// a{0}b is b, the literal prefix of the ECMAScript grammar does not apply.
+		When(Method(mock, get).Using(Matches("a\\{0\\}b", std::regex::basic))).AlwaysReturn(1);
+
+		HttpClient &i = mock.get();
+
+		ASSERT_EQUAL(1, i.get("b"));
+		ASSERT_THROW(i.get("ab"), fakeit::UnexpectedMethodCallException);
+	}
+
+	void test_c_string_matchers() {
+		Mock<HttpClient> mock;
+		When(Method(mock, log).Using(StartsWith<const char *>("error:"))).AlwaysReturn(1);
+		When(Method(mock, log).Using(Matches<const char *>("warning: [a-z]+"))).AlwaysReturn(2);
+
+		HttpClient &i = mock.get();
+
+		ASSERT_EQUAL(1, i.log("error: disk full"));
+		ASSERT_EQUAL(2, i.log("warning: slow"));
+		ASSERT_THROW(i.log(nullptr), fakeit::UnexpectedMethodCallException);
+		ASSERT_THROW(i.log("info: ok"), fakeit::UnexpectedMethodCallException);
+	}
+
+	void literal_prefix_of_pattern() {
+		using fakeit::internal::literalPrefixOf;
+		std::regex_constants::syntax_option_type ecma = std::regex_constants::ECMAScript;
+		ASSERT_EQUAL(std::string("/api/users/"), literalPrefixOf("/api/users/[0-9]+", ecma));
+		ASSERT_EQUAL(std::string("/api"), literalPrefixOf("^/api.*", ecma));
+		ASSERT_EQUAL(std::string("ab"), literalPrefixOf("abc*", ecma));
+		ASSERT_EQUAL(std::string("abc"), literalPrefixOf("abc+", ecma));
+		ASSERT_EQUAL(std::string(""), literalPrefixOf("a|b", ecma));
+		ASSERT_EQUAL(std::string(""), literalPrefixOf("abc", ecma | std::regex_constants::icase));
+		ASSERT_EQUAL(std::string("abc"), literalPrefixOf("abc", ecma | std::regex_constants::optimize));
+		ASSERT_EQUAL(std::string(""), literalPrefixOf("abc", std::regex_constants::basic));
+		ASSERT_EQUAL(std::string(""), literalPrefixOf("abc", std::regex_constants::extended));
+	}
+
+	void format_string_matchers() {
+		Mock<HttpClient> mock;
+		try {
+			fakeit::Verify(Method(mock, get).Using(Or(StartsWith("/a"), Matches("/b.*")))).setFileInfo("test file", 1, "test method").Exactly(Once);
+			FAIL();
+		} catch (SequenceVerificationException& e) {
+			std::string actualMsg { to_string(e) };
+			ASSERT_TRUE(actualMsg.find("Expected pattern: mock.get(Or(StartsWith(\"/a\"), Matches(\"/b.*\")))") != std::string::npos);
+		}
+	}
+} __StringArgumentMatching;
@@ -54,6 +54,9 @@ struct BasicVerification: tpunit::TestFixture {
 					TEST(BasicVerification::verify_method_was_called_exactly_x_times), //
 					TEST(BasicVerification::verify_method_was_called_exactly_x_times_with_quantifier), //
 					TEST(BasicVerification::should_throw_IllegalArgumentException_on_negative_times_argument), //
+					TEST(BasicVerification::verify_method_was_called_at_most_x_times), //
+					TEST(BasicVerification::verify_method_was_called_between_x_and_y_times), //
+					TEST(BasicVerification::should_throw_IllegalArgumentException_on_bad_range_argument), //
 					TEST(BasicVerification::verify_with_filter), //
 					TEST(BasicVerification::verify_no_other_invocations_for_mock), //
 					TEST(BasicVerification::verify_no_other_invocations_for_method_filter), //
@@ -323,6 +326,54 @@ struct BasicVerification: tpunit::TestFixture {
 		ASSERT_THROW(Verify(Method(mock,proc)).AtLeast(-1), std::invalid_argument);
 	}
 
+	void verify_method_was_called_at_most_x_times() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock,func), Method(mock,proc));
+		SomeInterface &i = mock.get();
+
+		Verify(Method(mock,func)).AtMost(2);
+		Verify(Method(mock,func)).AtMost(0);
+
+		i.func(1);
+		i.func(2);
+
+		Verify(Method(mock,func)).AtMost(2);
+		Verify(Method(mock,func)).AtMost(Times<3>());
+		Verify(Method(mock,func).Using(1)).AtMost(Once);
+		ASSERT_THROW(Verify(Method(mock,func)).AtMost(1), fakeit::VerificationException);
+		ASSERT_THROW(Verify(Method(mock,func)).AtMost(0), fakeit::VerificationException);
+		Verify(Method(mock,proc)).AtMost(0);
+	}
+
+	void verify_method_was_called_between_x_and_y_times() {
+		Mock<SomeInterface> mock;
+		Fake(Method(mock,func), Method(mock,proc));
+		SomeInterface &i = mock.get();
+
+		ASSERT_THROW(Verify(Method(mock,func)).Between(1, 2), fakeit::VerificationException);
+		Verify(Method(mock,func)).Between(0, 2);
+
+		i.func(1);
+		i.func(1);
+
+		Verify(Method(mock,func)).Between(1, 2);
+		Verify(Method(mock,func)).Between(2, 2);
+		Verify(Method(mock,func)).Between(Once, Times<3>());
+
+		i.func(1);
+
+		ASSERT_THROW(Verify(Method(mock,func)).Between(1, 2), fakeit::VerificationException);
+		ASSERT_FALSE(Verify(Method(mock,func)).Between(1, 2));
+		ASSERT_TRUE(Verify(Method(mock,func)).Between(3, 5));
+	}
+
+	void should_throw_IllegalArgumentException_on_bad_range_argument() {
+		Mock<SomeInterface> mock;
+		ASSERT_THROW(Verify(Method(mock,func)).AtMost(-1), std::invalid_argument);
+		ASSERT_THROW(Verify(Method(mock,func)).Between(-1, 1), std::invalid_argument);
+		ASSERT_THROW(Verify(Method(mock,func)).Between(2, 1), std::invalid_argument);
+	}
+
 	void verify_with_filter() {
 		Mock<SomeInterface> mock;
 		Fake(Method(mock,func), Method(mock,proc));
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+#define FAKEIT_TEST_METHODS_10(prefix) \
+    virtual int prefix##0() = 0; virtual int prefix##1() = 0; virtual int prefix##2() = 0; virtual int prefix##3() = 0; \
+    virtual int prefix##4() = 0; virtual int prefix##5() = 0; virtual int prefix##6() = 0; virtual int prefix##7() = 0; \
+    virtual int prefix##8() = 0; virtual int prefix##9() = 0;
+
+#define FAKEIT_TEST_METHODS_100(prefix) \
+    FAKEIT_TEST_METHODS_10(prefix##0) FAKEIT_TEST_METHODS_10(prefix##1) FAKEIT_TEST_METHODS_10(prefix##2) \
+    FAKEIT_TEST_METHODS_10(prefix##3) FAKEIT_TEST_METHODS_10(prefix##4) FAKEIT_TEST_METHODS_10(prefix##5) \
+    FAKEIT_TEST_METHODS_10(prefix##6) FAKEIT_TEST_METHODS_10(prefix##7) FAKEIT_TEST_METHODS_10(prefix##8) \
+    FAKEIT_TEST_METHODS_10(prefix##9)
+
+struct VirtualOffsetTests : tpunit::TestFixture {
+
+    VirtualOffsetTests() :
+            tpunit::TestFixture(
+                    //
+                    TEST(VirtualOffsetTests::offsets_follow_declaration_order),
+                    TEST(VirtualOffsetTests::destructor_offset),
+                    TEST(VirtualOffsetTests::virtual_table_size),
+                    TEST(VirtualOffsetTests::mock_type_with_more_than_1000_methods),
+                    TEST(VirtualOffsetTests::reject_non_virtual_method)
+                    //
+            ) {
+    }
+
+    struct SomeInterface {
+        virtual int func(int) = 0;
+
+        virtual void proc(int) = 0;
+
+        virtual ~SomeInterface() = default;
+
+        virtual int last() = 0;
+    };
+
+    struct NonVirtualMethod {
+        virtual ~NonVirtualMethod() = default;
+
+        int func(int) {
+            return 0;
+        }
+    };
+
+    struct HugeInterface {
+        FAKEIT_TEST_METHODS_100(a)
+        FAKEIT_TEST_METHODS_100(b)
+        FAKEIT_TEST_METHODS_100(c)
+        FAKEIT_TEST_METHODS_100(d)
+        FAKEIT_TEST_METHODS_100(e)
+        FAKEIT_TEST_METHODS_100(f)
+        FAKEIT_TEST_METHODS_100(g)
+        FAKEIT_TEST_METHODS_100(h)
+        FAKEIT_TEST_METHODS_100(i)
+        FAKEIT_TEST_METHODS_100(j)
+        FAKEIT_TEST_METHODS_100(k)
+
+        virtual int last(int) = 0;
+    };
+
+    void offsets_follow_declaration_order() {
+        ASSERT_EQUAL(0u, VTUtils::getOffset(&SomeInterface::func));
+        ASSERT_EQUAL(1u, VTUtils::getOffset(&SomeInterface::proc));
+        ASSERT_TRUE(VTUtils::getOffset(&SomeInterface::last) > VTUtils::getOffset(&SomeInterface::proc));
+    }
+
+    void destructor_offset() {
+        ASSERT_EQUAL(2u, VTUtils::getDestructorOffset<SomeInterface>());
+    }
+
+    void virtual_table_size() {
+        ASSERT_EQUAL(VTUtils::getOffset(&SomeInterface::last) + 1, VTUtils::getVTSize<SomeInterface>());
+    }
+
+    void mock_type_with_more_than_1000_methods() {
+#ifndef _MSC_VER
+        ASSERT_EQUAL(1100u, VTUtils::getOffset(&HugeInterface::last));
+        ASSERT_EQUAL(1101u, VTUtils::getVTSize<HugeInterface>());
+
+        Mock<HugeInterface> mock;
+        When(Method(mock, last)).Return(5);
+        When(Method(mock, a00)).Return(6);
+        ASSERT_EQUAL(5, mock.get().last(1));
+        ASSERT_EQUAL(6, mock.get().a00());
+#endif
+    }
+
+    void reject_non_virtual_method() {
+#ifndef _MSC_VER
+        ASSERT_THROW(VTUtils::getOffset(&NonVirtualMethod::func), std::invalid_argument);
+
+        Mock<NonVirtualMethod> mock;
+        ASSERT_THROW(When(Method(mock, func)).Return(1), std::invalid_argument);
+#endif
+    }
+
+} __VirtualOffsetTests;
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2014 Eran Pe'er.
+ *
+ * This program is made available under the terms of the MIT License.
+ *
+ * Created on Oct 19, 2026
+ */
+
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "tpunit++.hpp"
+#include "fakeit.hpp"
+
+using namespace fakeit;
+
+namespace {
+
+    // Number of allocations made through the global operator new while counting is on.
+    // The replacement operators below are shared by the whole test application,
+    // they only count while an AllocationCounter is alive.
+    bool isCountingAllocations = false;
+    unsigned int allocationsCount = 0;
+
+    struct AllocationCounter {
+        AllocationCounter() {
+            allocationsCount = 0;
+            isCountingAllocations = true;
+        }
+
+        ~AllocationCounter() {
+            isCountingAllocations = false;
+        }
+
+        unsigned int count() const {
+            return allocationsCount;
+        }
+    };
+
+    void *countedAllocation(std::size_t size) {
+        if (isCountingAllocations)
+            allocationsCount++;
+        void *p = std::malloc(size ? size : 1);
+        if (!p)
+            throw std::bad_alloc();
+        return p;
+    }
+}
+
+void *operator new(std::size_t size) {
+    return countedAllocation(size);
+}
+
+void *operator new[](std::size_t size) {
+    return countedAllocation(size);
+}
+
+void operator delete(void *p) NO_THROWS {
+    std::free(p);
+}
+
+void operator delete[](void *p) NO_THROWS {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) NO_THROWS {
+    ::operator delete(p);
+}
+
+void operator delete[](void *p, std::size_t) NO_THROWS {
+    ::operator delete[](p);
+}
+
+struct ZeroAllocationTests : tpunit::TestFixture {
+
+    ZeroAllocationTests() :
+            tpunit::TestFixture(
+                    //
+                    TEST(ZeroAllocationTests::always_return_does_not_allocate_when_history_is_disabled),
+                    TEST(ZeroAllocationTests::always_do_does_not_allocate_when_history_is_disabled),
+                    TEST(ZeroAllocationTests::do_and_return_sequence_does_not_allocate_when_history_is_disabled),
+                    TEST(ZeroAllocationTests::argument_matching_does_not_allocate_when_history_is_disabled),
+                    TEST(ZeroAllocationTests::large_lambda_is_not_copied_on_invocation),
+                    TEST(ZeroAllocationTests::invocations_are_recorded_when_history_is_enabled),
+                    TEST(ZeroAllocationTests::invocations_are_not_recorded_when_history_is_disabled),
+                    TEST(ZeroAllocationTests::history_can_be_disabled_after_stubbing),
+                    TEST(ZeroAllocationTests::mock_creation_does_not_depend_on_virtual_table_size)
+                    //
+            ) {
+    }
+
+    struct SomeInterface {
+        virtual int func(int) = 0;
+
+        virtual void proc(int) = 0;
+
+        virtual int calc(int, const std::string &) = 0;
+    };
+
+    struct LargeInterface {
+        virtual int f0() = 0; virtual int f1() = 0; virtual int f2() = 0; virtual int f3() = 0;
+        virtual int f4() = 0; virtual int f5() = 0; virtual int f6() = 0; virtual int f7() = 0;
+        virtual int f8() = 0; virtual int f9() = 0; virtual int f10() = 0; virtual int f11() = 0;
+        virtual int f12() = 0; virtual int f13() = 0; virtual int f14() = 0; virtual int f15() = 0;
+    };
+
+    void always_return_does_not_allocate_when_history_is_disabled() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        When(Method(mock, func)).AlwaysReturn(1);
+        Fake(Method(mock, proc));
+        SomeInterface &i = mock.get();
+
+        int sum = 0;
+        AllocationCounter allocations;
+        for (int n = 0; n < 1000; n++) {
+            sum += i.func(n);
+            i.proc(n);
+        }
+        ASSERT_EQUAL(0u, allocations.count());
+        ASSERT_EQUAL(1000, sum);
+    }
+
+    void always_do_does_not_allocate_when_history_is_disabled() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        int calls = 0;
+        When(Method(mock, func)).AlwaysDo([&calls](int a) { calls++; return a; });
+        SomeInterface &i = mock.get();
+
+        AllocationCounter allocations;
+        for (int n = 0; n < 1000; n++) {
+            i.func(n);
+        }
+        ASSERT_EQUAL(0u, allocations.count());
+        ASSERT_EQUAL(1000, calls);
+    }
+
+    void do_and_return_sequence_does_not_allocate_when_history_is_disabled() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        When(Method(mock, func)).Do([](int a) { return a; }).Return(5).AlwaysReturn(7);
+        SomeInterface &i = mock.get();
+
+        AllocationCounter allocations;
+        int a = i.func(3);
+        int b = i.func(3);
+        int c = i.func(3);
+        ASSERT_EQUAL(0u, allocations.count());
+        ASSERT_EQUAL(3, a);
+        ASSERT_EQUAL(5, b);
+        ASSERT_EQUAL(7, c);
+    }
+
+    void argument_matching_does_not_allocate_when_history_is_disabled() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        When(Method(mock, calc)).AlwaysReturn(0);
+        When(Method(mock, calc).Using(Gt(10), _)).AlwaysReturn(1);
+        When(Method(mock, calc).Using(1, "a")).AlwaysReturn(2);
+        SomeInterface &i = mock.get();
+        std::string a{"a"};
+
+        int sum = 0;
+        AllocationCounter allocations;
+        for (int n = 0; n < 100; n++) {
+            sum += i.calc(1, a);
+            sum += i.calc(20, a);
+            sum += i.calc(5, a);
+        }
+        ASSERT_EQUAL(0u, allocations.count());
+        ASSERT_EQUAL(300, sum);
+    }
+
+    void large_lambda_is_not_copied_on_invocation() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        long a = 1, b = 2, c = 3, d = 4;
+        // too big for std::function's inline buffer.
+        When(Method(mock, func)).AlwaysDo([a, b, c, d](int) { return (int) (a + b + c + d); });
+        SomeInterface &i = mock.get();
+
+        AllocationCounter allocations;
+        int rv = i.func(1);
+        ASSERT_EQUAL(0u, allocations.count());
+        ASSERT_EQUAL(10, rv);
+    }
+
+    void invocations_are_recorded_when_history_is_enabled() {
+        Mock<SomeInterface> mock;
+        When(Method(mock, func)).AlwaysReturn(1);
+        SomeInterface &i = mock.get();
+
+        AllocationCounter allocations;
+        i.func(1);
+        ASSERT_NOT_EQUAL(0u, allocations.count());
+        Verify(Method(mock, func).Using(1)).Once();
+    }
+
+    void invocations_are_not_recorded_when_history_is_disabled() {
+        Mock<SomeInterface> mock;
+        mock.DisableInvocationHistory();
+        When(Method(mock, func)).AlwaysReturn(1);
+        mock.get().func(1);
+        Verify(Method(mock, func)).Never();
+
+        mock.EnableInvocationHistory();
+        mock.get().func(2);
+        Verify(Method(mock, func).Using(2)).Once();
+        Verify(Method(mock, func)).Once();
+    }
+
+    void history_can_be_disabled_after_stubbing() {
+        Mock<SomeInterface> mock;
+        When(Method(mock, func)).AlwaysReturn(1);
+        mock.DisableInvocationHistory();
+        SomeInterface &i = mock.get();
+
+        AllocationCounter allocations;
+        i.func(1);
+        ASSERT_EQUAL(0u, allocations.count());
+        Verify(Method(mock, func)).Never();
+    }
+
+    template<typename C>
+    static unsigned int countMockCreationAllocations() {
+        AllocationCounter allocations;
+        Mock<C> mock;
+        return allocations.count();
+    }
+
+    void mock_creation_does_not_depend_on_virtual_table_size() {
+        // first mocks of each type build the shared virtual tables.
+        Mock<SomeInterface> small;
+        Mock<LargeInterface> large;
+
+        ASSERT_EQUAL(countMockCreationAllocations<SomeInterface>(), countMockCreationAllocations<LargeInterface>());
+    }
+
+} __ZeroAllocationTests;